@@ -1,199 +1,1523 @@
-/*
- * Main Probe-Scope Application
- * 
- * @Company
- *   Probe-Scope Team
- * 
- * @File Name
- *   app.c
- * 
- * @Summary
- *   FPGA Interface and Sample Memory
-*/
-
-#include "app.h"
-#include <stdio.h>
-#include <string.h>
-
-void __delay_us(unsigned long time)
-{
-    unsigned long start, stop;
-    start = __builtin_mfc0(_CP0_COUNT, _CP0_COUNT_SELECT);
-    stop = time * (192 / 2);
-    while ((__builtin_mfc0(_CP0_COUNT, _CP0_COUNT_SELECT) - start) < stop);
-}
-
-
-
-uint8_t CACHE_ALIGN text_buffer[20];
-
-app_data_t appData;
-cdc_comms_t * gp_comms;
-
-
-/// Callbacks
-
-static void
-APP_ISR_Blink (uintptr_t context)
-{
-	app_data_t * appData = (app_data_t *) context;
-	
-	if (appData->blink_tick)
-	{
-		LED0_Clear();
-		appData->blink_tick = false;
-	}
-	else	
-	{
-		LED0_Set();
-		appData->blink_tick = true;
-	}
-}
-
-static void
-APP_ISR_Tick (uintptr_t context)
-{
-	app_data_t * appData = (app_data_t *) context;
-	
-	appData->comms_tick = true;
-}
-
-
-/// Main Functions
-
-void APP_Initialize(void)
-{
-    // Place the App state machine in its initial state.
-    appData.state = APP_STATE_INIT;
-	
-	// Set up USB comms
-	gp_comms = &(appData.comms);
-	comms_init(&(appData.comms), USB_DEVICE_INDEX_0);
-	if_init();
-	
-	appData.blink_tick = false;
-	appData.comms_tick = false;
-	appData.stop_acq = false;
-	
-	appData.buf.first = appData.buf.data;
-	appData.buf.last = appData.buf.data;
-	appData.buf.end = appData.buf.data + SAMPLES;
-	
-	FPP_D0_InputEnable();
-	FPP_D1_InputEnable();
-	FPP_D2_InputEnable();
-	FPP_D3_InputEnable();
-	FPP_D4_InputEnable();
-	FPP_D5_InputEnable();
-	FPP_D6_InputEnable();
-	FPP_D7_InputEnable();
-	FPP_DRDY_InputEnable();
-	FPP_DREQ_OutputEnable();
-	FPP_DREQ_Clear();
-	FPIO0_InputEnable(); // trigger
-	FPIO1_OutputEnable(); // pic ready
-	FPIO2_InputEnable(); // fpga ready
-}
-
-void APP_Tasks(void)
-{
-	if_task();
-    switch(appData.state)
-    {
-        case APP_STATE_INIT:
-			
-			SYS_TIME_CallbackRegisterMS(APP_ISR_Blink, (uintptr_t) &appData, 500, SYS_TIME_PERIODIC);
-			SYS_TIME_CallbackRegisterMS(APP_ISR_Tick, (uintptr_t) &appData, 1, SYS_TIME_PERIODIC);
-			
-			appData.state = APP_STATE_WAIT_FOR_CONFIGURATION;
-			appData.triggered = false;
-			
-            break;
-		
-        case APP_STATE_WAIT_FOR_CONFIGURATION:
-			
-            // Check if the device was configured
-            if(appData.comms.isConfigured)
-            {
-                appData.state = APP_STATE_WAIT_TRIGGER;
-            }
-            
-            break;
-		
-		case APP_STATE_WAIT_TRIGGER:
-			LED1_Clear();
-			if (FPIO0_Get()) // FPGA trigger out
-			{
-				LED1_Set();
-				FPIO1_Set(); // indicate ready to receive
-				appData.buf.first = appData.buf.data;
-				appData.buf.last = appData.buf.data;
-				appData.state = APP_STATE_WAIT_BUFFER;
-			}
-			break;
-		
-		case APP_STATE_WAIT_BUFFER:
-			if (FPIO2_Get()) // FPGA second half full
-			{
-				appData.state = APP_STATE_GET_SAMPLE;
-			}
-			break;
-		
-		case APP_STATE_GET_SAMPLE:
-			if (!appData.stop_acq)
-			{
-				if (FPIO2_Get())
-				{
-					FPP_DREQ_Set();
-					LED2_Toggle();
-			
-					appData.state = APP_STATE_WAIT_SAMPLE;
-					// no break to enable immediate check for response
-				}
-				else
-				{
-					appData.state = APP_STATE_TRIGGERED;
-					FPIO1_Clear();
-					break;
-				}
-			}
-		
-		case APP_STATE_WAIT_SAMPLE:
-			if (FPP_DRDY_Get())
-			{
-				uint8_t inter = 0;
-				inter |= (FPP_D0_Get() << 0);
-				inter |= (FPP_D1_Get() << 1);
-				inter |= (FPP_D2_Get() << 2);
-				inter |= (FPP_D3_Get() << 3);
-				inter |= (FPP_D4_Get() << 4);
-				inter |= (FPP_D5_Get() << 5);
-				inter |= (FPP_D6_Get() << 6);
-				inter |= (FPP_D7_Get() << 7);
-				
-				FPP_DREQ_Clear();
-				
-				appData.state = APP_STATE_GET_SAMPLE;
-				
-				*(appData.buf.last) = inter;
-				appData.buf.last++;
-				if (appData.buf.last >= appData.buf.end)
-				{
-					appData.buf.last = appData.buf.end;
-					appData.state = APP_STATE_TRIGGERED;
-					FPIO1_Clear();
-				}
-			}
-			break;
-		
-		case APP_STATE_TRIGGERED:
-			break;
-		
-        case APP_STATE_ERROR:
-        default:
-            
-            break;
-    }
-	
-	comms_task(&(appData.comms));
-}
+/*
+ * Main Probe-Scope Application
+ * 
+ * @Company
+ *   Probe-Scope Team
+ * 
+ * @File Name
+ *   app.c
+ * 
+ * @Summary
+ *   FPGA Interface and Sample Memory
+*/
+
+#include "app.h"
+#include <stdio.h>
+#include <string.h>
+
+void __delay_us(unsigned long time)
+{
+    unsigned long start, stop;
+    start = __builtin_mfc0(_CP0_COUNT, _CP0_COUNT_SELECT);
+    stop = time * (192 / 2);
+    while ((__builtin_mfc0(_CP0_COUNT, _CP0_COUNT_SELECT) - start) < stop);
+}
+
+
+
+uint8_t CACHE_ALIGN text_buffer[20];
+
+app_data_t appData;
+
+// Sample memory is written by DMA, keep it out of the data cache
+static uint8_t __attribute__((coherent, aligned(16))) app_arena[APP_ARENA_SIZE];
+
+// Mask test limits, lower and upper byte per sample point. The host
+// writes them through IF_VM_MASK, they outlive mode changes.
+uint8_t __attribute__((aligned(4))) app_mask[2U * APP_MASK_POINTS];
+
+// Min/max pairs are built here, then replace the record they came from
+static uint8_t app_peaks[2U * APP_BUCKETS_MAX];
+cdc_comms_t * gp_comms;
+
+
+/// Callbacks
+
+static void
+APP_ISR_Blink (uintptr_t context)
+{
+	app_data_t * appData = (app_data_t *) context;
+	
+	if (appData->blink_tick)
+	{
+		LED0_Clear();
+		appData->blink_tick = false;
+	}
+	else	
+	{
+		LED0_Set();
+		appData->blink_tick = true;
+	}
+}
+
+static void
+APP_ISR_Tick (uintptr_t context)
+{
+	app_data_t * appData = (app_data_t *) context;
+	
+	appData->comms_tick = true;
+}
+
+static void
+APP_ISR_CaptureDone (uintptr_t context)
+{
+	BaseType_t woken = pdFALSE;
+	
+	xTaskNotifyFromISR(xAPP_Tasks, APP_EVENT_CAPTURE, eSetBits, &woken);
+	portEND_SWITCHING_ISR(woken);
+}
+
+static void
+APP_ISR_Edge (capture_edge_t edge, uintptr_t context)
+{
+	BaseType_t woken = pdFALSE;
+	uint32_t event = (CAPTURE_EDGE_TRIGGER == edge)
+		? APP_EVENT_TRIGGER : APP_EVENT_READY;
+	
+	xTaskNotifyFromISR(xAPP_Tasks, event, eSetBits, &woken);
+	portEND_SWITCHING_ISR(woken);
+}
+
+static void
+APP_ISR_Comms (uintptr_t context)
+{
+	BaseType_t woken = pdFALSE;
+	
+	xTaskNotifyFromISR(xAPP_Tasks, APP_EVENT_COMMS, eSetBits, &woken);
+	portEND_SWITCHING_ISR(woken);
+}
+
+
+/// Helpers
+
+static bool
+APP_PreTriggerOn (void)
+{
+	// Normal mode with a trigger position runs the capture ring
+	return APP_MODE_NORMAL == appData.active.mode
+		&& appData.active.trigger_position;
+}
+
+static uint32_t
+APP_PreTrigger (void)
+{
+	// Samples kept from before the trigger
+	uint32_t pre = (uint32_t) (((uint64_t) appData.active.record_length
+		* appData.active.trigger_position) / 100U);
+	
+	// At 100 % the trigger is the last sample
+	if (pre >= appData.active.record_length)
+	{
+		pre = appData.active.record_length - 1U;
+	}
+	return pre;
+}
+
+static void
+APP_CaptureStats (void)
+{
+	capture_stats_t cs;
+	
+	capture_stats_get(&cs);
+	
+	appData.stats.capture_count++;
+	if (cs.error)
+	{
+		appData.stats.capture_errors++;
+	}
+	
+	appData.stats.capture_bytes = cs.bytes;
+	
+	// Segment triggers are handled by the capture ISRs and a pre-trigger
+	// capture was running long before its trigger, neither is timed here
+	if (APP_MODE_SEGMENTED != appData.active.mode
+		&& APP_MODE_ROLL != appData.active.mode && !APP_PreTriggerOn())
+	{
+		appData.stats.trig_latency = cs.start_tick - appData.trigger_tick;
+		if (0 == appData.stats.trig_latency_min
+			|| appData.stats.trig_latency < appData.stats.trig_latency_min)
+		{
+			appData.stats.trig_latency_min = appData.stats.trig_latency;
+		}
+		if (appData.stats.trig_latency > appData.stats.trig_latency_max)
+		{
+			appData.stats.trig_latency_max = appData.stats.trig_latency;
+		}
+	}
+	appData.stats.capture_ticks = cs.ticks;
+	appData.stats.capture_cpu_ticks = cs.cpu_ticks;
+	
+	if (cs.ticks)
+	{
+		appData.stats.capture_rate = (uint32_t) (((uint64_t) cs.bytes
+			* CORETIMER_FrequencyGet()) / cs.ticks);
+		appData.stats.capture_load = (uint16_t) (((uint64_t) cs.cpu_ticks
+			* 1000U) / cs.ticks);
+	}
+}
+
+static rudimentary_buffer_t *
+APP_FrameOldest (void)
+{
+	rudimentary_buffer_t * oldest = NULL;
+	unsigned int i;
+	
+	for (i = 0; i < appData.ring_depth; i++)
+	{
+		rudimentary_buffer_t * b = &(appData.ring[i]);
+		
+		if (APP_BUF_FULL == b->state && (NULL == oldest
+			|| (int32_t) (b->seq - oldest->seq) < 0))
+		{
+			oldest = b;
+		}
+	}
+	
+	return oldest;
+}
+
+static rudimentary_buffer_t *
+APP_FrameClaim (void)
+{
+	// Take a free buffer, or overwrite the oldest frame not yet sent
+	rudimentary_buffer_t * b;
+	unsigned int i;
+	
+	for (i = 0; i < appData.ring_depth; i++)
+	{
+		if (APP_BUF_FREE == appData.ring[i].state)
+		{
+			return &(appData.ring[i]);
+		}
+	}
+	
+	b = APP_FrameOldest();
+	if (NULL != b)
+	{
+		appData.stats.frames_dropped++;
+	}
+	
+	return b;
+}
+
+static bool
+APP_RingBusy (void)
+{
+	unsigned int i;
+	
+	for (i = 0; i < appData.ring_depth; i++)
+	{
+		if (APP_BUF_FILLING == appData.ring[i].state
+			|| APP_BUF_SENDING == appData.ring[i].state)
+		{
+			return true;
+		}
+	}
+	
+	return false;
+}
+
+static uint32_t
+APP_AverageScratch (const app_regs_t * regs)
+{
+	// Arena taken by average mode for the capture and the sums
+	uint32_t record = (regs->record_length + 15U) & ~15U;
+	uint32_t scratch = record + record * sizeof(uint16_t);
+	
+	if (regs->average_count > APP_AVERAGE_FOLD)
+	{
+		scratch += record * sizeof(uint32_t);
+	}
+	return scratch;
+}
+
+static void
+APP_AccCaptureSetup (const app_regs_t * regs, uint8_t * scratch)
+{
+	appData.acc_capture.data = scratch;
+	appData.acc_capture.first = scratch;
+	appData.acc_capture.last = scratch;
+	appData.acc_capture.end = scratch + regs->record_length;
+	appData.acc_capture.state = APP_BUF_FREE;
+}
+
+static void
+APP_AverageSetup (const app_regs_t * regs, uint8_t * scratch)
+{
+	uint32_t record = (regs->record_length + 15U) & ~15U;
+	
+	APP_AccCaptureSetup(regs, scratch);
+	appData.avg_sums = (uint16_t *) (scratch + record);
+	appData.avg_wide = NULL;
+	appData.avg_done = 0;
+	
+	memset(appData.avg_sums, 0, regs->record_length * sizeof(uint16_t));
+	if (regs->average_count > APP_AVERAGE_FOLD)
+	{
+		appData.avg_wide = (uint32_t *) (appData.avg_sums + record);
+		memset(appData.avg_wide, 0, regs->record_length * sizeof(uint32_t));
+	}
+}
+
+static uint32_t
+APP_HistogramScratch (const app_regs_t * regs)
+{
+	// Arena taken by histogram mode for the capture and the counters
+	uint32_t record = (regs->record_length + 15U) & ~15U;
+	
+	return record + ((regs->hist_columns * regs->hist_rows
+		* sizeof(uint16_t) + 15U) & ~15U);
+}
+
+static void
+APP_HistogramSetup (const app_regs_t * regs, uint8_t * scratch)
+{
+	uint32_t record = (regs->record_length + 15U) & ~15U;
+	
+	APP_AccCaptureSetup(regs, scratch);
+	appData.hist = (uint16_t *) (scratch + record);
+	appData.hist_size = regs->hist_columns * regs->hist_rows
+		* sizeof(uint16_t);
+	appData.hist_clear = false;
+	appData.regs.hist_waveforms = 0;
+	memset(appData.hist, 0, appData.hist_size);
+}
+
+static void
+APP_RingSetup (const app_regs_t * regs)
+{
+	// Carve the arena into as many frames as fit, up to APP_RING_DEPTH.
+	// Queued frames of the old layout are lost.
+	uint32_t size = regs->record_length;
+	uint32_t depth = APP_RING_DEPTH;
+	uint32_t arena = APP_ARENA_SIZE;
+	uint32_t stride;
+	unsigned int i;
+	
+	appData.hist_size = 0;
+	if (APP_MODE_SEGMENTED == regs->mode)
+	{
+		size = regs->segment_count
+			* (sizeof(uint64_t) + regs->record_length);
+	}
+	else if (APP_MODE_ROLL == regs->mode)
+	{
+		size = regs->chunk_length;
+		depth = APP_STREAM_DEPTH;
+	}
+	else if (APP_MODE_MIXED == regs->mode)
+	{
+		// Room for the bit planes behind the samples, the raw port words
+		// of the capture in progress go at the end of the arena
+		size = regs->record_length + CAPTURE_LOGIC_CHANNELS
+			* CAPTURE_LOGIC_PLANE(regs->record_length);
+		arena -= (CAPTURE_LOGIC_RAW(regs->record_length) + 15U) & ~15U;
+	}
+	else if (APP_MODE_AVERAGE == regs->mode)
+	{
+		// Records are captured and summed at the end of the arena, only
+		// the averaged frames are queued
+		size = regs->record_length * (regs->average_bits / 8U);
+		arena -= APP_AverageScratch(regs);
+		APP_AverageSetup(regs, app_arena + arena);
+	}
+	else if (APP_MODE_SPECTRUM == regs->mode)
+	{
+		// Bins take no more room than the record, the transform is done
+		// at the end of the arena
+		arena -= FFT_WORK_SIZE(regs->record_length);
+		appData.fft_work = (int16_t *) (app_arena + arena);
+	}
+	else if (APP_MODE_HISTOGRAM == regs->mode)
+	{
+		// Records are captured and binned at the end of the arena, no
+		// frames are queued
+		arena -= APP_HistogramScratch(regs);
+		APP_HistogramSetup(regs, app_arena + arena);
+	}
+	stride = (size + 15U) & ~15U;
+	appData.logic = (uint16_t *) (app_arena + arena);
+	
+	for (i = 0; i < appData.ring_depth; i++)
+	{
+		if (APP_BUF_FULL == appData.ring[i].state)
+		{
+			appData.stats.frames_dropped++;
+		}
+	}
+	
+	appData.ring_depth = arena / stride;
+	if (appData.ring_depth > depth)
+	{
+		appData.ring_depth = depth;
+	}
+	
+	for (i = 0; i < appData.ring_depth; i++)
+	{
+		rudimentary_buffer_t * b = &(appData.ring[i]);
+		
+		b->data = app_arena + i * stride;
+		b->first = b->data;
+		b->last = b->data;
+		b->end = b->data + size;
+		b->wrap = 0;
+		b->logic_length = 0;
+		b->peak_length = 0;
+		b->averages = 0;
+		b->spectrum_length = 0;
+		b->sample_bits = 8;
+		b->state = APP_BUF_FREE;
+		b->seq = 0;
+		b->segments = 0;
+		b->segment_length = regs->record_length;
+		b->stream = (APP_MODE_ROLL == regs->mode);
+	}
+	
+	appData.active = *regs;
+	appData.active.ring_depth = appData.ring_depth;
+	appData.regs.ring_depth = appData.ring_depth;
+}
+
+static bool
+APP_RegsChanged (void)
+{
+	return appData.regs.record_length != appData.active.record_length
+		|| appData.regs.mode != appData.active.mode
+		|| appData.regs.segment_count != appData.active.segment_count
+		|| appData.regs.chunk_length != appData.active.chunk_length
+		|| appData.regs.flush_ms != appData.active.flush_ms
+		|| appData.regs.trigger_position != appData.active.trigger_position
+		|| appData.regs.decimation != appData.active.decimation
+		|| appData.regs.average_count != appData.active.average_count
+		|| appData.regs.average_bits != appData.active.average_bits
+		|| appData.regs.hist_columns != appData.active.hist_columns
+		|| appData.regs.hist_rows != appData.active.hist_rows;
+}
+
+static void
+APP_RegsLatch (void)
+{
+	// What is done with a record, the layout aside. Taken as a capture is
+	// armed, a write while it runs holds from the next record.
+	appData.active.measure = appData.regs.measure;
+	appData.active.spectrum_window = appData.regs.spectrum_window;
+	appData.active.spectrum_format = appData.regs.spectrum_format;
+	appData.active.qualify = appData.regs.qualify;
+	appData.active.qualify_level = appData.regs.qualify_level;
+	appData.active.qualify_level2 = appData.regs.qualify_level2;
+	appData.active.qualify_width = appData.regs.qualify_width;
+	appData.active.qualify_pattern = appData.regs.qualify_pattern;
+	appData.active.mask_test = appData.regs.mask_test;
+	appData.active.sample_rate = appData.regs.sample_rate;
+}
+
+static uint32_t
+APP_FrameLength (const rudimentary_buffer_t * frame)
+{
+	// Samples in the record without the bit planes behind them. A frame
+	// that came from the pre-trigger ring is full, from data to end.
+	return (frame->wrap ? frame->end - frame->data
+		: frame->last - frame->first) - frame->logic_length;
+}
+
+static void
+APP_Decimate (rudimentary_buffer_t * frame, uint32_t length)
+{
+	// One min/max pair per bucket of the record, which is in two spans if
+	// it came from the pre-trigger ring. Bucket i covers samples
+	// i * length / buckets up to the next bucket.
+	uint32_t buckets = appData.active.decimation;
+	uint32_t split = frame->wrap ? frame->wrap : length;
+	uint32_t start = 0;
+	uint32_t i;
+	
+	for (i = 0; i < buckets; i++)
+	{
+		uint32_t stop = ((i + 1U) * length) / buckets;
+		uint8_t lo = 0xFF;
+		uint8_t hi = 0;
+		
+		if (start < split)
+		{
+			dsp_minmax(frame->first + start,
+				((stop < split) ? stop : split) - start, &lo, &hi);
+		}
+		if (stop > split)
+		{
+			uint32_t from = (start > split) ? start : split;
+			dsp_minmax(frame->data + (from - split), stop - from, &lo, &hi);
+		}
+		
+		app_peaks[2U * i] = lo;
+		app_peaks[2U * i + 1U] = hi;
+		start = stop;
+	}
+	
+	memcpy(frame->data, app_peaks, 2U * buckets);
+	frame->first = frame->data;
+	frame->last = frame->data + 2U * buckets;
+	frame->wrap = 0;
+	frame->peak_length = length;
+}
+
+static void
+APP_Measure (rudimentary_buffer_t * frame, uint32_t length)
+{
+	// Measurements over the record, in two spans if it came from the
+	// pre-trigger ring. Only the passes the selected ones need are run,
+	// their time is in the stats to check against the trigger rate.
+	uint32_t split = frame->wrap ? frame->wrap : length;
+	uint32_t t0 = CORETIMER_CounterGet();
+	measure_state_t state;
+	
+	measure_init(&state, appData.active.measure);
+	measure_levels(&state, frame->first, split);
+	measure_levels(&state, frame->data, length - split);
+	if (appData.active.measure & MEASURE_EDGES)
+	{
+		measure_edges(&state, frame->first, split);
+		measure_edges(&state, frame->data, length - split);
+	}
+	measure_result(&state, appData.active.sample_rate, &(frame->measure));
+	
+	appData.stats.meas_ticks = CORETIMER_CounterGet() - t0;
+	appData.stats.meas_cost = (uint32_t) (((uint64_t) appData.stats.meas_ticks
+		* 1000U) / length);
+}
+
+static bool
+APP_Qualify (rudimentary_buffer_t * frame)
+{
+	// Second stage trigger over the record just captured, in two spans if
+	// it came from the pre-trigger ring
+	uint32_t length = APP_FrameLength(frame);
+	uint32_t split = frame->wrap ? frame->wrap : length;
+	uint32_t t0 = CORETIMER_CounterGet();
+	bool match;
+	
+	if (QUALIFY_PATTERN == (appData.active.qualify & QUALIFY_TYPE_MASK))
+	{
+		match = qualify_pattern(frame->first + length, length,
+			appData.active.qualify_pattern, appData.active.qualify_width);
+	}
+	else
+	{
+		qualify_state_t state;
+		
+		qualify_init(&state, appData.active.qualify,
+			(uint8_t) appData.active.qualify_level,
+			(uint8_t) appData.active.qualify_level2,
+			appData.active.qualify_width);
+		match = qualify_scan(&state, frame->first, split)
+			|| qualify_scan(&state, frame->data, length - split);
+	}
+	
+	appData.stats.qual_ticks = CORETIMER_CounterGet() - t0;
+	return match;
+}
+
+static void
+APP_MaskInit (void)
+{
+	// Wide open until the host uploads a mask
+	uint32_t i;
+	
+	for (i = 0; i < APP_MASK_POINTS; i++)
+	{
+		app_mask[2U * i] = 0;
+		app_mask[2U * i + 1U] = 0xFF;
+	}
+}
+
+static bool
+APP_MaskTest (rudimentary_buffer_t * frame, uint32_t length)
+{
+	// True if the record stays inside the mask, in two spans if it came
+	// from the pre-trigger ring
+	uint32_t split = frame->wrap ? frame->wrap : length;
+	uint32_t t0 = CORETIMER_CounterGet();
+	uint32_t first;
+	
+	if (appData.mask_clear)
+	{
+		appData.mask_clear = false;
+		appData.stats.mask_pass = 0;
+		appData.stats.mask_fail = 0;
+		appData.stats.mask_first = 0;
+	}
+	
+	first = dsp_mask_find(frame->first, app_mask, split);
+	if (first == split)
+	{
+		first += dsp_mask_find(frame->data, &(app_mask[2U * split]),
+			length - split);
+	}
+	appData.stats.mask_ticks = CORETIMER_CounterGet() - t0;
+	
+	if (first < length)
+	{
+		appData.stats.mask_fail++;
+		appData.stats.mask_first = first;
+		return false;
+	}
+	
+	appData.stats.mask_pass++;
+	return true;
+}
+
+static void
+APP_Spectrum (rudimentary_buffer_t * frame)
+{
+	// Replace the record with the bins of its spectrum
+	uint32_t length = appData.active.record_length;
+	unsigned int format = appData.active.spectrum_format;
+	uint32_t t0 = CORETIMER_CounterGet();
+	
+	fft_load(appData.fft_work, frame->data, length,
+		appData.active.spectrum_window);
+	fft_run(appData.fft_work, length);
+	fft_bins(appData.fft_work, length, appData.active.spectrum_window, format,
+		frame->data);
+	
+	frame->spectrum_length = length;
+	frame->sample_bits = (FFT_FORMAT_LOG == format) ? 8U : 16U;
+	frame->first = frame->data;
+	frame->last = frame->data + (length / 2U) * (frame->sample_bits / 8U);
+	appData.stats.fft_ticks = CORETIMER_CounterGet() - t0;
+}
+
+static rudimentary_buffer_t *
+APP_Accumulate (uint32_t length)
+{
+	// Sum the record in acc_capture. After average_count records return
+	// a frame with their mean, NULL until then. A record cut short is
+	// left out.
+	uint32_t record = appData.active.record_length;
+	uint32_t count = appData.active.average_count;
+	uint32_t t0 = CORETIMER_CounterGet();
+	rudimentary_buffer_t * frame;
+	uint32_t i;
+	
+	if (length != record)
+	{
+		return NULL;
+	}
+	
+	dsp_accumulate(appData.avg_sums, appData.acc_capture.data, record);
+	appData.avg_done++;
+	if (NULL != appData.avg_wide && (0 == appData.avg_done % APP_AVERAGE_FOLD
+		|| appData.avg_done == count))
+	{
+		dsp_fold(appData.avg_wide, appData.avg_sums, record);
+	}
+	
+	appData.stats.avg_ticks = CORETIMER_CounterGet() - t0;
+	appData.stats.avg_cost = (uint32_t) (((uint64_t) appData.stats.avg_ticks
+		* 1000U) / record);
+	
+	if (appData.avg_done < count)
+	{
+		return NULL;
+	}
+	
+	appData.avg_done = 0;
+	frame = APP_FrameClaim();
+	if (NULL != frame)
+	{
+		frame->segments = 0;
+		frame->averages = count;
+		frame->sample_bits = (uint8_t) appData.active.average_bits;
+		frame->first = frame->data;
+		frame->last = frame->data + record * (frame->sample_bits / 8U);
+		
+		for (i = 0; i < record; i++)
+		{
+			uint32_t sum = (NULL != appData.avg_wide)
+				? appData.avg_wide[i] : appData.avg_sums[i];
+			
+			if (16U == frame->sample_bits)
+			{
+				((uint16_t *) frame->data)[i] = (uint16_t) (((sum << 8)
+					+ count / 2U) / count);
+			}
+			else
+			{
+				frame->data[i] = (uint8_t) ((sum + count / 2U) / count);
+			}
+		}
+		appData.rate_averaged++;
+	}
+	
+	memset(appData.avg_sums, 0, record * sizeof(uint16_t));
+	if (NULL != appData.avg_wide)
+	{
+		memset(appData.avg_wide, 0, record * sizeof(uint32_t));
+	}
+	return frame;
+}
+
+static void
+APP_Histogram (uint32_t length)
+{
+	// Count the record in acc_capture into the histogram: the column of
+	// each sample's time, the row of its amplitude. A record cut short is
+	// left out.
+	uint32_t record = appData.active.record_length;
+	uint32_t columns = appData.active.hist_columns;
+	uint32_t rows = appData.active.hist_rows;
+	uint32_t span = record / columns;
+	unsigned int shift = 8U - (unsigned int) __builtin_ctz(rows);
+	uint32_t t0 = CORETIMER_CounterGet();
+	uint32_t c;
+	
+	if (appData.hist_clear)
+	{
+		appData.hist_clear = false;
+		appData.regs.hist_waveforms = 0;
+		memset(appData.hist, 0, appData.hist_size);
+	}
+	
+	if (length != record)
+	{
+		return;
+	}
+	
+	for (c = 0; c < columns; c++)
+	{
+		dsp_bin(appData.hist + c * rows, appData.acc_capture.data
+			+ c * span, span, shift);
+	}
+	
+	appData.regs.hist_waveforms++;
+	appData.rate_binned++;
+	appData.stats.hist_ticks = CORETIMER_CounterGet() - t0;
+}
+
+static void
+APP_SegmentStamp (void)
+{
+	// The ISRs latch the 32 bit core timer. Extend finished segments to the
+	// 64 bit SYS_TIME counter (same clock) while they are too recent for
+	// the core timer to have wrapped.
+	uint64_t * stamps = (uint64_t *) appData.fill->data;
+	uint32_t done = capture_segments_done();
+	uint64_t now64 = SYS_TIME_Counter64Get();
+	uint32_t now32 = CORETIMER_CounterGet();
+	
+	for (; appData.seg_stamped < done; appData.seg_stamped++)
+	{
+		uint32_t tick = (uint32_t) stamps[appData.seg_stamped];
+		stamps[appData.seg_stamped] = now64 - (uint32_t) (now32 - tick);
+	}
+}
+
+static void
+APP_WaitEdge (capture_edge_t edge, uint32_t event)
+{
+	// An edge that is already there counts as arrived
+	appData.events &= ~event;
+	if (capture_edge_arm(edge))
+	{
+		appData.events |= event;
+	}
+}
+
+static bool
+APP_FlushDue (void)
+{
+	// Roll mode: the chunk in progress has waited longer than flush_ms
+	return APP_MODE_ROLL == appData.active.mode && appData.active.flush_ms
+		&& CORETIMER_CounterGet() - appData.chunk_tick
+		>= appData.active.flush_ms * (CORETIMER_FrequencyGet() / 1000U);
+}
+
+static TickType_t
+APP_IdleTicks (void)
+{
+	// How long the task may sleep while it only waits on hardware or the
+	// host, 0 if there is work to do
+	TickType_t ticks = pdMS_TO_TICKS(APP_IDLE_MS);
+	
+	switch (appData.state)
+	{
+		case APP_STATE_WAIT_FOR_CONFIGURATION:
+			break;
+		
+		case APP_STATE_WAIT_BUFFER:
+		case APP_STATE_WAIT_SAMPLE:
+			if (APP_MODE_ROLL == appData.active.mode
+				&& appData.active.flush_ms)
+			{
+				// Wake up in time to flush the chunk
+				if (APP_FlushDue())
+				{
+					return 0;
+				}
+				if (ticks > pdMS_TO_TICKS(appData.active.flush_ms))
+				{
+					ticks = pdMS_TO_TICKS(appData.active.flush_ms);
+				}
+				if (0 == ticks)
+				{
+					ticks = 1;
+				}
+			}
+			break;
+		
+		case APP_STATE_WAIT_TRIGGER:
+			if (APP_MODE_SEGMENTED == appData.active.mode
+				|| APP_MODE_ROLL == appData.active.mode || APP_PreTriggerOn()
+				|| (appData.events & APP_EVENT_TRIGGER))
+			{
+				return 0;
+			}
+			break;
+		
+		default:
+			return 0;
+	}
+	
+	return if_idle() ? ticks : 0;
+}
+
+static void
+APP_RateUpdate (void)
+{
+	uint32_t elapsed = CORETIMER_CounterGet() - appData.rate_tick;
+	uint32_t freq = CORETIMER_FrequencyGet();
+	
+	if (elapsed < freq)
+	{
+		return;
+	}
+	
+	appData.stats.wfm_rate = (uint32_t) (((uint64_t) appData.rate_sent
+		* freq) / elapsed);
+	appData.stats.trig_rate = (uint32_t) (((uint64_t) appData.rate_captured
+		* freq) / elapsed);
+	appData.stats.stream_rate = (uint32_t) (((uint64_t) appData.rate_stream
+		* freq) / elapsed);
+	appData.stats.avg_rate = (uint32_t) (((uint64_t) appData.rate_averaged
+		* freq) / elapsed);
+	appData.stats.hist_rate = (uint32_t) (((uint64_t) appData.rate_binned
+		* freq) / elapsed);
+	
+	appData.rate_tick += elapsed;
+	appData.rate_sent = 0;
+	appData.rate_captured = 0;
+	appData.rate_stream = 0;
+	appData.rate_averaged = 0;
+	appData.rate_binned = 0;
+}
+
+
+/// Main Functions
+
+void APP_Initialize(void)
+{
+    // Place the App state machine in its initial state.
+    appData.state = APP_STATE_INIT;
+	
+	// Set up USB comms
+	gp_comms = &(appData.comms);
+	comms_init(&(appData.comms), USB_DEVICE_INDEX_0);
+	if_init();
+	
+	appData.blink_tick = false;
+	appData.comms_tick = false;
+	appData.stop_acq = false;
+	appData.events = 0;
+	memset(&(appData.stats), 0, sizeof(appData.stats));
+	
+	appData.regs.record_length = APP_RECORD_DEFAULT;
+	appData.regs.mode = APP_MODE_NORMAL;
+	appData.regs.segment_count = 1;
+	appData.regs.chunk_length = APP_CHUNK_DEFAULT;
+	appData.regs.flush_ms = APP_FLUSH_DEFAULT;
+	appData.regs.trigger_position = 0;
+	appData.regs.decimation = 0;
+	appData.regs.average_count = APP_AVERAGE_DEFAULT;
+	appData.regs.average_bits = 8;
+	appData.regs.compression = CODEC_NONE;
+	appData.regs.measure = 0;
+	appData.regs.spectrum_window = FFT_WINDOW_HANN;
+	appData.regs.spectrum_format = FFT_FORMAT_LINEAR;
+	appData.regs.qualify = QUALIFY_NONE;
+	appData.regs.qualify_level = 128;
+	appData.regs.qualify_level2 = 192;
+	appData.regs.qualify_width = 0;
+	appData.regs.qualify_pattern = 0;
+	appData.regs.hist_columns = APP_HIST_COLUMNS_DEFAULT;
+	appData.regs.hist_rows = APP_HIST_ROWS_DEFAULT;
+	appData.regs.hist_waveforms = 0;
+	appData.hist = NULL;
+	appData.hist_size = 0;
+	appData.hist_clear = false;
+	appData.regs.mask_test = 0;
+	appData.regs.crc = 0;
+	appData.regs.notify = 0;
+	appData.regs.sample_rate = 0;
+	appData.mask_clear = false;
+	APP_MaskInit();
+	appData.ring_depth = 0;
+	APP_RingSetup(&(appData.regs));
+	
+	// Nothing is captured yet, the arena is free for the benchmarks. The
+	// stats are packed, results go through locals.
+	{
+		uint32_t ratio[BENCH_WAVES];
+		uint32_t cost[BENCH_WAVES];
+		uint32_t fft[BENCH_FFT_SIZES];
+		uint32_t esc[BENCH_WAVES];
+		
+		bench_codec(app_arena, ratio, cost);
+		memcpy(appData.stats.bench_ratio, ratio, sizeof(ratio));
+		memcpy(appData.stats.bench_cost, cost, sizeof(cost));
+		bench_fft(app_arena, fft);
+		memcpy(appData.stats.fft_bench, fft, sizeof(fft));
+		bench_escape(app_arena, esc, cost);
+		memcpy(appData.stats.esc_ref, esc, sizeof(esc));
+		memcpy(appData.stats.esc_cost, cost, sizeof(cost));
+	}
+	appData.stats.crc_engine = crc_init();
+	appData.fill = NULL;
+	appData.seq = 0;
+	
+	appData.rate_tick = CORETIMER_CounterGet();
+	appData.rate_sent = 0;
+	appData.rate_captured = 0;
+	appData.rate_stream = 0;
+	appData.rate_averaged = 0;
+	appData.rate_binned = 0;
+	appData.chunk_end_tick = appData.rate_tick;
+	
+	// The FPGA lines all belong to the capture front end
+	capture_init();
+	capture_callback_register(APP_ISR_CaptureDone, (uintptr_t) &appData);
+	capture_edge_callback_register(APP_ISR_Edge, (uintptr_t) &appData);
+	comms_event_callback_register(&(appData.comms), APP_ISR_Comms,
+		(uintptr_t) &appData);
+}
+
+void APP_Tasks(void)
+{
+	uint32_t events = 0;
+	
+	// Sleep until an edge, a capture or USB traffic needs attention
+	xTaskNotifyWait(0, UINT32_MAX, &events, APP_IdleTicks());
+	appData.events |= events;
+	
+	if_task();
+    switch(appData.state)
+    {
+        case APP_STATE_INIT:
+			
+			SYS_TIME_CallbackRegisterMS(APP_ISR_Blink, (uintptr_t) &appData, 500, SYS_TIME_PERIODIC);
+			SYS_TIME_CallbackRegisterMS(APP_ISR_Tick, (uintptr_t) &appData, 1, SYS_TIME_PERIODIC);
+			
+			appData.state = APP_STATE_WAIT_FOR_CONFIGURATION;
+			appData.triggered = false;
+			
+            break;
+		
+        case APP_STATE_WAIT_FOR_CONFIGURATION:
+			
+            // Check if the device was configured
+            if(appData.comms.isConfigured)
+            {
+                APP_WaitEdge(CAPTURE_EDGE_TRIGGER, APP_EVENT_TRIGGER);
+                appData.state = APP_STATE_WAIT_TRIGGER;
+            }
+            
+            break;
+		
+		case APP_STATE_WAIT_TRIGGER:
+			LED1_Clear();
+			if (APP_RegsChanged())
+			{
+				// New layout, wait until no buffer is in use
+				if (APP_RingBusy())
+				{
+					break;
+				}
+				APP_RingSetup(&(appData.regs));
+			}
+			APP_RegsLatch();
+			
+			if (APP_MODE_SEGMENTED == appData.active.mode)
+			{
+				// The capture ISRs run the handshake for every segment
+				appData.fill = APP_FrameClaim();
+				if (NULL == appData.fill)
+				{
+					break;
+				}
+				
+				appData.fill->segments = appData.active.segment_count;
+				appData.seg_stamped = 0;
+				appData.events &= ~(APP_EVENT_CAPTURE | APP_EVENT_TRIGGER);
+				
+				if (capture_segments_start(appData.fill->data
+					+ appData.fill->segments * sizeof(uint64_t),
+					appData.fill->segment_length, appData.fill->segments,
+					(uint64_t *) appData.fill->data))
+				{
+					LED1_Set();
+					appData.fill->state = APP_BUF_FILLING;
+					appData.state = APP_STATE_WAIT_SAMPLE;
+				}
+				break;
+			}
+			
+			if (APP_MODE_ROLL == appData.active.mode)
+			{
+				// Free running, take the next chunk as soon as the FPGA
+				// has one ready
+				appData.fill = APP_FrameClaim();
+				if (NULL == appData.fill)
+				{
+					break;
+				}
+				
+				appData.fill->segments = 0;
+				appData.chunk_tick = CORETIMER_CounterGet();
+				
+				APP_WaitEdge(CAPTURE_EDGE_READY, APP_EVENT_READY);
+				capture_ready(true); // indicate ready to receive
+				appData.fill->state = APP_BUF_FILLING;
+				appData.fill->first = appData.fill->data;
+				appData.fill->last = appData.fill->data;
+				appData.state = APP_STATE_WAIT_BUFFER;
+				break;
+			}
+			
+			if (APP_PreTriggerOn() && !appData.stop_acq)
+			{
+				// Keep sampling into the frame as a ring and let the
+				// capture engine freeze it on the trigger
+				appData.fill = APP_FrameClaim();
+				if (NULL == appData.fill)
+				{
+					break;
+				}
+				
+				appData.fill->segments = 0;
+				capture_edge_disarm(CAPTURE_EDGE_TRIGGER);
+				appData.events &= ~(APP_EVENT_CAPTURE | APP_EVENT_TRIGGER);
+				
+				capture_ready(true); // indicate ready to receive
+				if (capture_ring_start(appData.fill->data,
+					appData.fill->end - appData.fill->data, APP_PreTrigger()))
+				{
+					LED1_Set();
+					appData.fill->state = APP_BUF_FILLING;
+					appData.state = APP_STATE_WAIT_SAMPLE;
+				}
+				else
+				{
+					capture_ready(false);
+					appData.fill = NULL;
+				}
+				break;
+			}
+			
+			if (appData.events & APP_EVENT_TRIGGER) // FPGA trigger out
+			{
+				if (APP_MODE_AVERAGE == appData.active.mode
+					|| APP_MODE_HISTOGRAM == appData.active.mode)
+				{
+					// Summed or binned as it comes in, never queued
+					appData.fill = &(appData.acc_capture);
+				}
+				else
+				{
+					appData.fill = APP_FrameClaim();
+				}
+				if (NULL == appData.fill)
+				{
+					break;
+				}
+				
+				appData.fill->segments = 0;
+				appData.fill->sample_bits = 8;
+				appData.events &= ~APP_EVENT_TRIGGER;
+				appData.trigger_tick = capture_edge_tick(CAPTURE_EDGE_TRIGGER);
+				
+				LED1_Set();
+				APP_WaitEdge(CAPTURE_EDGE_READY, APP_EVENT_READY);
+				capture_ready(true); // indicate ready to receive
+				appData.fill->state = APP_BUF_FILLING;
+				appData.fill->first = appData.fill->data;
+				appData.fill->last = appData.fill->data;
+				appData.state = APP_STATE_WAIT_BUFFER;
+			}
+			break;
+		
+		case APP_STATE_WAIT_BUFFER:
+			if (appData.events & APP_EVENT_READY) // FPGA second half full
+			{
+				appData.events &= ~APP_EVENT_READY;
+				appData.state = APP_STATE_GET_SAMPLE;
+			}
+			else if (APP_FlushDue())
+			{
+				// Nothing arrived in time, give the chunk back
+				capture_edge_disarm(CAPTURE_EDGE_READY);
+				capture_ready(false);
+				appData.fill->state = APP_BUF_FREE;
+				appData.fill = NULL;
+				appData.state = APP_STATE_WAIT_TRIGGER;
+			}
+			break;
+		
+		case APP_STATE_GET_SAMPLE:
+			if (!appData.stop_acq)
+			{
+				bool started;
+				
+				appData.events &= ~APP_EVENT_CAPTURE;
+				if (APP_MODE_MIXED == appData.active.mode)
+				{
+					started = capture_mixed_start(appData.fill->data,
+						appData.logic, appData.active.record_length);
+				}
+				else
+				{
+					started = capture_start(appData.fill->data,
+						appData.fill->end - appData.fill->data);
+				}
+				if (started)
+				{
+					if (appData.fill->stream)
+					{
+						appData.stats.chunk_gap = CORETIMER_CounterGet()
+							- appData.chunk_end_tick;
+						if (appData.stats.chunk_gap > appData.stats.chunk_gap_max)
+						{
+							appData.stats.chunk_gap_max = appData.stats.chunk_gap;
+						}
+					}
+					LED2_Toggle();
+					appData.state = APP_STATE_WAIT_SAMPLE;
+				}
+			}
+			break;
+		
+		case APP_STATE_WAIT_SAMPLE:
+			if (APP_FlushDue() && capture_busy())
+			{
+				// Send what is there, the completion path picks it up
+				capture_abort();
+				appData.stats.stream_flushes++;
+				appData.events |= APP_EVENT_CAPTURE;
+			}
+			
+			if (appData.events & APP_EVENT_CAPTURE)
+			{
+				appData.events &= ~APP_EVENT_CAPTURE;
+				
+				if (appData.fill->segments)
+				{
+					// Called after every segment, wait for the last one
+					APP_SegmentStamp();
+					if (capture_busy())
+					{
+						break;
+					}
+					
+					uint32_t done = capture_segments_done();
+					if (done < appData.fill->segments)
+					{
+						// Cut short by a DMA error, close the gap between
+						// the timestamps in use and the segments
+						memmove(appData.fill->data + done * sizeof(uint64_t),
+							appData.fill->data + appData.fill->segments
+							* sizeof(uint64_t),
+							done * appData.fill->segment_length);
+						appData.fill->segments = done;
+					}
+					appData.fill->last = appData.fill->data + done
+						* (sizeof(uint64_t) + appData.fill->segment_length);
+					appData.rate_captured += appData.fill->segments;
+					appData.stats.trig_count += appData.fill->segments;
+					APP_CaptureStats();
+				}
+				else if (APP_PreTriggerOn())
+				{
+					// The record is in the frame rotated, the interface
+					// sends it in two spans so it arrives in order
+					uint32_t oldest = capture_ring_stop();
+					
+					capture_ready(false);
+					APP_CaptureStats();
+					appData.fill->first = appData.fill->data + oldest;
+					appData.fill->last = appData.fill->first;
+					appData.fill->wrap = appData.fill->end
+						- appData.fill->first;
+					if (0 == oldest)
+					{
+						appData.fill->last = appData.fill->end;
+						appData.fill->wrap = 0;
+					}
+					appData.rate_captured++;
+					appData.stats.trig_count++;
+				}
+				else
+				{
+					capture_ready(false);
+					APP_CaptureStats();
+					appData.fill->last = appData.fill->data
+						+ appData.stats.capture_bytes;
+					appData.rate_captured++;
+					appData.stats.trig_count++;
+					
+					if (APP_MODE_MIXED == appData.active.mode)
+					{
+						// Bit planes go right behind the samples
+						capture_logic_pack(appData.fill->last, appData.logic,
+							appData.stats.capture_bytes);
+						appData.fill->logic_length = CAPTURE_LOGIC_CHANNELS
+							* CAPTURE_LOGIC_PLANE(appData.stats.capture_bytes);
+						appData.fill->last += appData.fill->logic_length;
+					}
+				}
+				
+				if (QUALIFY_NONE != appData.active.qualify
+					&& 0 == appData.fill->segments && !appData.fill->stream
+					&& !APP_Qualify(appData.fill))
+				{
+					// Not what the host is after, drop it and re-arm
+					appData.stats.qual_rejected++;
+					appData.fill->state = APP_BUF_FREE;
+					appData.fill = NULL;
+					APP_WaitEdge(CAPTURE_EDGE_TRIGGER, APP_EVENT_TRIGGER);
+					appData.state = APP_STATE_WAIT_TRIGGER;
+					break;
+				}
+				
+				if (APP_MODE_HISTOGRAM == appData.active.mode)
+				{
+					// Stays on the device until the host reads it
+					appData.fill->state = APP_BUF_FREE;
+					appData.fill = NULL;
+					APP_Histogram(appData.stats.capture_bytes);
+					APP_WaitEdge(CAPTURE_EDGE_TRIGGER, APP_EVENT_TRIGGER);
+					appData.state = APP_STATE_WAIT_TRIGGER;
+					break;
+				}
+				
+				if (APP_MODE_AVERAGE == appData.active.mode)
+				{
+					appData.fill->state = APP_BUF_FREE;
+					appData.fill = APP_Accumulate(
+						appData.stats.capture_bytes);
+					if (NULL == appData.fill)
+					{
+						// More records to go
+						APP_WaitEdge(CAPTURE_EDGE_TRIGGER, APP_EVENT_TRIGGER);
+						appData.state = APP_STATE_WAIT_TRIGGER;
+						break;
+					}
+				}
+				
+				if (appData.active.mask_test && 0 == appData.fill->segments
+					&& !appData.fill->stream
+					&& 8U == appData.fill->sample_bits)
+				{
+					uint32_t length = APP_FrameLength(appData.fill);
+					
+					if (length <= APP_MASK_POINTS
+						&& APP_MaskTest(appData.fill, length))
+					{
+						// Passed, the count is all the host needs
+						appData.fill->state = APP_BUF_FREE;
+						appData.fill = NULL;
+						APP_WaitEdge(CAPTURE_EDGE_TRIGGER, APP_EVENT_TRIGGER);
+						appData.state = APP_STATE_WAIT_TRIGGER;
+						break;
+					}
+				}
+				
+				appData.fill->measure.valid = 0;
+				if (appData.active.measure && 0 == appData.fill->segments
+					&& !appData.fill->stream
+					&& 8U == appData.fill->sample_bits)
+				{
+					// On the samples as captured, before decimation
+					uint32_t length = APP_FrameLength(appData.fill);
+					
+					if (length)
+					{
+						APP_Measure(appData.fill, length);
+					}
+				}
+				
+				appData.fill->spectrum_length = 0;
+				if (APP_MODE_SPECTRUM == appData.active.mode)
+				{
+					// A record cut short has no spectrum, it goes out as is
+					if (appData.fill->last - appData.fill->first
+						== appData.active.record_length)
+					{
+						APP_Spectrum(appData.fill);
+					}
+				}
+				
+				appData.fill->peak_length = 0;
+				if (APP_MODE_NORMAL == appData.active.mode
+					&& appData.active.decimation)
+				{
+					// Display rate transfer, send min/max pairs instead
+					uint32_t length = APP_FrameLength(appData.fill);
+					
+					if (length >= 2U * appData.active.decimation)
+					{
+						APP_Decimate(appData.fill, length);
+					}
+				}
+				
+				if (appData.fill->stream)
+				{
+					appData.chunk_end_tick = CORETIMER_CounterGet();
+					if (appData.fill->last == appData.fill->first)
+					{
+						// flushed before any sample came in
+						appData.fill->state = APP_BUF_FREE;
+						appData.fill = NULL;
+						appData.state = APP_STATE_WAIT_TRIGGER;
+						break;
+					}
+				}
+				
+				// Queue the frame and re-arm right away, the interface
+				// sends it while the next one is captured
+				appData.fill->seq = appData.seq++;
+				appData.fill->state = APP_BUF_FULL;
+				appData.fill = NULL;
+				
+				APP_WaitEdge(CAPTURE_EDGE_TRIGGER, APP_EVENT_TRIGGER);
+				appData.state = APP_STATE_WAIT_TRIGGER;
+			}
+			break;
+		
+        case APP_STATE_ERROR:
+        default:
+            
+            break;
+    }
+	
+	comms_task(&(appData.comms));
+	APP_RateUpdate();
+}
+
+rudimentary_buffer_t *
+APP_FrameAcquire (void)
+{
+	rudimentary_buffer_t * oldest = APP_FrameOldest();
+	
+	if (NULL != oldest)
+	{
+		oldest->state = APP_BUF_SENDING;
+	}
+	
+	return oldest;
+}
+
+void
+APP_FrameRelease (rudimentary_buffer_t * frame)
+{
+	frame->state = APP_BUF_FREE;
+	
+	if (frame->stream)
+	{
+		appData.stats.stream_chunks++;
+		appData.stats.stream_bytes += frame->last - frame->first;
+		appData.rate_stream += frame->last - frame->first;
+	}
+	else
+	{
+		appData.stats.frames_sent++;
+		appData.rate_sent++;
+	}
+}
+
+bool
+APP_Streaming (void)
+{
+	return APP_MODE_ROLL == appData.active.mode;
+}
+
+bool
+APP_RegsWrite (uint32_t offset, const uint8_t * data, uint32_t length)
+{
+	app_regs_t regs = appData.regs;
+	
+	if (offset + length > sizeof(regs))
+	{
+		return false;
+	}
+	
+	memcpy(&(((uint8_t *) &regs)[offset]), data, length);
+	
+	if (regs.record_length < APP_RECORD_MIN
+		|| regs.record_length > APP_RECORD_MAX
+		|| regs.mode > APP_MODE_HISTOGRAM)
+	{
+		return false;
+	}
+	
+	if (regs.chunk_length < APP_RECORD_MIN
+		|| regs.chunk_length > APP_RECORD_MAX
+		|| regs.flush_ms > APP_FLUSH_MAX
+		|| regs.trigger_position > APP_TRIGGER_POS_MAX)
+	{
+		return false;
+	}
+	
+	// Buckets of at least two samples, so the pairs fit in the record
+	if (regs.decimation > APP_BUCKETS_MAX
+		|| regs.decimation > regs.record_length / 2U)
+	{
+		return false;
+	}
+	
+	if (APP_MODE_SEGMENTED == regs.mode && (0 == regs.segment_count
+		|| regs.segment_count > APP_SEGMENTS_MAX
+		|| (uint64_t) regs.segment_count
+		* (sizeof(uint64_t) + regs.record_length) > APP_ARENA_SIZE))
+	{
+		return false;
+	}
+	
+	if (APP_MODE_MIXED == regs.mode && regs.record_length
+		+ CAPTURE_LOGIC_CHANNELS * CAPTURE_LOGIC_PLANE(regs.record_length)
+		+ CAPTURE_LOGIC_RAW(regs.record_length) + 32U > APP_ARENA_SIZE)
+	{
+		return false;
+	}
+	
+	if (APP_MODE_AVERAGE == regs.mode && (0 == regs.average_count
+		|| regs.average_count > APP_AVERAGE_MAX
+		|| (8U != regs.average_bits && 16U != regs.average_bits)
+		|| APP_AverageScratch(&regs) + ((regs.record_length
+		* (regs.average_bits / 8U) + 15U) & ~15U) > APP_ARENA_SIZE))
+	{
+		return false;
+	}
+	
+	if (regs.compression > CODEC_DELTA || (regs.measure & ~MEASURE_ALL))
+	{
+		return false;
+	}
+	
+	if (regs.spectrum_window > FFT_WINDOW_HANN
+		|| regs.spectrum_format > FFT_FORMAT_LOG)
+	{
+		return false;
+	}
+	
+	if (QUALIFY_NONE != regs.qualify && ((regs.qualify
+		& ~(QUALIFY_TYPE_MASK | QUALIFY_NEGATIVE))
+		|| (regs.qualify & QUALIFY_TYPE_MASK) > QUALIFY_PATTERN
+		|| 0 == regs.qualify_level || regs.qualify_level > 255U
+		|| regs.qualify_width > APP_RECORD_MAX))
+	{
+		return false;
+	}
+	
+	// Runts need the second level above the first, patterns the logic
+	// channels of mixed-signal mode
+	if ((QUALIFY_RUNT == (regs.qualify & QUALIFY_TYPE_MASK)
+		&& (regs.qualify_level2 <= regs.qualify_level
+		|| regs.qualify_level2 > 255U))
+		|| (QUALIFY_PATTERN == (regs.qualify & QUALIFY_TYPE_MASK)
+		&& APP_MODE_MIXED != regs.mode))
+	{
+		return false;
+	}
+	
+	if (regs.crc > 1U || (regs.notify & ~IF_EVENTS))
+	{
+		return false;
+	}
+	
+	if (regs.mask_test > 1U || (regs.mask_test
+		&& regs.record_length > APP_MASK_POINTS))
+	{
+		return false;
+	}
+	
+	// Columns of whole samples, rows a power of two, and the counters in
+	// their share of the arena
+	if (APP_MODE_HISTOGRAM == regs.mode && (0 == regs.hist_columns
+		|| regs.hist_columns > regs.record_length
+		|| 0 != regs.record_length % regs.hist_columns
+		|| regs.hist_rows < APP_HIST_ROWS_MIN
+		|| regs.hist_rows > APP_HIST_ROWS_MAX
+		|| (regs.hist_rows & (regs.hist_rows - 1U))
+		|| regs.hist_columns * regs.hist_rows * sizeof(uint16_t)
+		> APP_HIST_MAX
+		|| APP_HistogramScratch(&regs) > APP_ARENA_SIZE))
+	{
+		return false;
+	}
+	
+	// A transform length, power of two
+	if (APP_MODE_SPECTRUM == regs.mode
+		&& (regs.record_length < FFT_LENGTH_MIN
+		|| regs.record_length > FFT_LENGTH_MAX
+		|| (regs.record_length & (regs.record_length - 1U))))
+	{
+		return false;
+	}
+	
+	// ring_depth is read only
+	appData.regs.record_length = regs.record_length;
+	appData.regs.mode = regs.mode;
+	appData.regs.segment_count = regs.segment_count;
+	appData.regs.chunk_length = regs.chunk_length;
+	appData.regs.flush_ms = regs.flush_ms;
+	appData.regs.trigger_position = regs.trigger_position;
+	appData.regs.decimation = regs.decimation;
+	appData.regs.average_count = regs.average_count;
+	appData.regs.average_bits = regs.average_bits;
+	appData.regs.compression = regs.compression;
+	appData.regs.measure = regs.measure;
+	appData.regs.spectrum_window = regs.spectrum_window;
+	appData.regs.spectrum_format = regs.spectrum_format;
+	appData.regs.qualify = regs.qualify;
+	appData.regs.qualify_level = regs.qualify_level;
+	appData.regs.qualify_level2 = regs.qualify_level2;
+	appData.regs.qualify_width = regs.qualify_width;
+	appData.regs.qualify_pattern = regs.qualify_pattern;
+	appData.regs.hist_columns = regs.hist_columns;
+	appData.regs.hist_rows = regs.hist_rows;
+	
+	appData.regs.mask_test = regs.mask_test;
+	appData.regs.crc = regs.crc;
+	appData.regs.notify = regs.notify;
+	appData.regs.sample_rate = regs.sample_rate;
+	
+	// hist_waveforms counts on the device, any write to it clears
+	if (offset <= offsetof(app_regs_t, hist_waveforms)
+		&& offset + length > offsetof(app_regs_t, hist_waveforms))
+	{
+		appData.hist_clear = true;
+	}
+	if (offset <= offsetof(app_regs_t, mask_test)
+		&& offset + length > offsetof(app_regs_t, mask_test))
+	{
+		appData.mask_clear = true;
+	}
+	return true;
+}
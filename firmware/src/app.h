@@ -1,169 +1,401 @@
-/*
- * Main Probe-Scope Application
- * 
- * @Company
- *   Probe-Scope Team
- * 
- * @File Name
- *   app.h
- * 
- * @Summary
- *   FPGA Interface and Sample Memory
-*/
-
-#ifndef _APP_H
-#define _APP_H
-
-
-#include <stdint.h>
-#include <stdbool.h>
-#include <stddef.h>
-#include <stdlib.h>
-#include "configuration.h"
-#include "definitions.h"
-#include "comms.h"
-#include "interface.h"
-
-
-#define SAMPLES 8192
-
-
-#ifdef	__cplusplus
-extern "C"
-{
-#endif
-
-
-typedef enum
-{
-	// Application's state machine's initial state.
-	APP_STATE_INIT=0,
-	
-	// Application waits for device configuration
-	APP_STATE_WAIT_FOR_CONFIGURATION,
-	
-	// Wait for trigger from FPGA
-	APP_STATE_WAIT_TRIGGER,
-	
-	// Wait for FPGA ready signal
-	APP_STATE_WAIT_BUFFER,
-	
-	// Request ADC sample from FPGA
-	APP_STATE_GET_SAMPLE,
-	
-	// Read ADC sample from FPGA
-	APP_STATE_WAIT_SAMPLE,
-	
-	// Trigger gotten, wait for IF module to reset it
-	APP_STATE_TRIGGERED,
-	
-	// Application Error state
-	APP_STATE_ERROR
-} app_states_t;
-
-
-typedef struct
-{
-	uint8_t * first;
-	uint8_t * last;
-	uint8_t * end;
-	uint8_t data[SAMPLES];
-} rudimentary_buffer_t;
-
-
-typedef struct
-{
-	app_states_t state;
-	
-	cdc_comms_t comms;
-	
-	bool blink_tick;
-	bool comms_tick;
-	
-	int8_t last_sample;
-	
-	SYS_TIME_HANDLE usb_timeout;
-	
-	rudimentary_buffer_t buf;
-	
-	bool stop_acq;
-	bool triggered;
-} app_data_t;
-
-
-/*******************************************************************************
-  Function:
-    void APP_Initialize ( void )
-
-  Summary:
-     MPLAB Harmony application initialization routine.
-
-  Description:
-    This function initializes the Harmony application.  It places the 
-    application in its initial state and prepares it to run so that its 
-    APP_Tasks function can be called.
-
-  Precondition:
-    All other system initialization routines should be called before calling
-    this routine (in "SYS_Initialize").
-
-  Parameters:
-    None.
-
-  Returns:
-    None.
-
-  Example:
-    <code>
-    APP_Initialize();
-    </code>
-
-  Remarks:
-    This routine must be called from the SYS_Initialize function.
-*/
-void APP_Initialize ( void );
-
-
-/*******************************************************************************
-  Function:
-    void APP_Tasks ( void )
-
-  Summary:
-    MPLAB Harmony application tasks function
-
-  Description:
-    This routine is the Harmony application's tasks function.  It
-    defines the application's state machine and core logic.
-
-  Precondition:
-    The system and application initialization ("SYS_Initialize") should be
-    called before calling this.
-
-  Parameters:
-    None.
-
-  Returns:
-    None.
-
-  Example:
-    <code>
-    APP_Tasks();
-    </code>
-
-  Remarks:
-    This routine must be called from SYS_Tasks() routine.
- */
-
-void APP_Tasks ( void );
-
-
-extern cdc_comms_t * gp_comms;
-extern app_data_t appData;
-
-
-
-#ifdef	__cplusplus
-}
-#endif
-
-#endif /* _APP_H */
+/*
+ * Main Probe-Scope Application
+ * 
+ * @Company
+ *   Probe-Scope Team
+ * 
+ * @File Name
+ *   app.h
+ * 
+ * @Summary
+ *   FPGA Interface and Sample Memory
+*/
+
+#ifndef _APP_H
+#define _APP_H
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include "configuration.h"
+#include "definitions.h"
+#include "comms.h"
+#include "interface.h"
+#include "capture.h"
+#include "dsp.h"
+#include "codec.h"
+#include "measure.h"
+#include "fft.h"
+#include "qualify.h"
+#include "bench.h"
+#include "crc.h"
+
+
+// Sample memory, carved into the capture ring at the configured record length
+#define APP_ARENA_SIZE (256U * 1024U)
+
+// Record length limits in samples, see app_regs_t
+#define APP_RECORD_DEFAULT 8192U
+#define APP_RECORD_MIN     16U
+#define APP_RECORD_MAX     APP_ARENA_SIZE
+
+// Acquisition modes, see app_regs_t
+#define APP_MODE_NORMAL    0U
+#define APP_MODE_SEGMENTED 1U
+#define APP_MODE_ROLL      2U
+#define APP_MODE_MIXED     3U
+#define APP_MODE_AVERAGE   4U
+#define APP_MODE_SPECTRUM  5U
+#define APP_MODE_HISTOGRAM 6U
+
+// Segmented mode: segments per frame, each with a 64 bit timestamp
+#define APP_SEGMENTS_MAX   8192U
+
+// Roll mode: chunk defaults, flush_ms 0 waits for full chunks
+#define APP_CHUNK_DEFAULT  512U
+#define APP_FLUSH_DEFAULT  50U
+#define APP_FLUSH_MAX      10000U
+
+// Normal mode: share of the record captured before the trigger, percent
+#define APP_TRIGGER_POS_MAX 100U
+
+// Normal mode: most min/max buckets a record is decimated to, 0 is off
+#define APP_BUCKETS_MAX    4096U
+
+// Average mode: records per averaged frame, and how many the 16 bit sums
+// take before they are folded into 32 bit ones
+#define APP_AVERAGE_DEFAULT 16U
+#define APP_AVERAGE_MAX     65535U
+#define APP_AVERAGE_FOLD    256U
+
+// Histogram mode: time columns by amplitude rows of 16 bit counters, the
+// counters take at most half the arena
+#define APP_HIST_COLUMNS_DEFAULT 256U
+#define APP_HIST_ROWS_DEFAULT    256U
+#define APP_HIST_ROWS_MIN        16U
+#define APP_HIST_ROWS_MAX        256U
+#define APP_HIST_MAX             (APP_ARENA_SIZE / 2U)
+
+// Mask test: most sample points the mask covers, a lower and upper limit
+// byte each
+#define APP_MASK_POINTS 16384U
+
+// Most capture buffers in the acquisition ring, frames queue here while the
+// interface is still busy sending an older one. Long records get fewer.
+#define APP_RING_DEPTH 4
+
+// Roll mode queues this many chunks, to ride out USB hiccups
+#define APP_STREAM_DEPTH 16
+
+// Task notification bits for the app task
+#define APP_EVENT_CAPTURE (1UL << 0)
+#define APP_EVENT_TRIGGER (1UL << 1)
+#define APP_EVENT_READY   (1UL << 2)
+#define APP_EVENT_COMMS   (1UL << 3)
+
+// Longest the app task sleeps with nothing to do. Everything it waits on
+// sends a notification, this only paces the housekeeping.
+#define APP_IDLE_MS 10
+
+
+#ifdef	__cplusplus
+extern "C"
+{
+#endif
+
+
+typedef enum
+{
+	// Application's state machine's initial state.
+	APP_STATE_INIT=0,
+	
+	// Application waits for device configuration
+	APP_STATE_WAIT_FOR_CONFIGURATION,
+	
+	// Wait for trigger from FPGA
+	APP_STATE_WAIT_TRIGGER,
+	
+	// Wait for FPGA ready signal
+	APP_STATE_WAIT_BUFFER,
+	
+	// Start DMA transfer of the record from FPGA
+	APP_STATE_GET_SAMPLE,
+	
+	// Wait for DMA transfer of the record to complete
+	APP_STATE_WAIT_SAMPLE,
+	
+	// Application Error state
+	APP_STATE_ERROR
+} app_states_t;
+
+
+// Ownership of a ring buffer, acquisition only writes FREE buffers and the
+// interface only reads FULL ones
+typedef enum
+{
+	APP_BUF_FREE = 0,
+	APP_BUF_FILLING,
+	APP_BUF_FULL,
+	APP_BUF_SENDING
+} app_buf_state_t;
+
+// In segmented mode data holds segments timestamps (uint64_t, SYS_TIME
+// counter at each trigger) followed by the segments, first..last spans both.
+// A pre-trigger record is left rotated in data: if wrap is set it runs
+// from first to end, then on from data to last. A mixed-signal frame ends
+// in logic_length bytes of bit planes, see capture_logic_pack(). A
+// decimated frame holds min/max pairs standing for peak_length samples.
+// An averaged frame is the mean of averages records, in sample_bits wide
+// samples: 8, or 16 with 8 fractional bits. A spectrum frame holds the
+// bins of a spectrum_length point transform, sample_bits wide (see fft.h).
+// measure holds the automatic measurements of the record as it was before
+// decimation or transform.
+typedef struct rudimentary_buffer
+{
+	uint8_t * first;
+	uint8_t * last;
+	uint8_t * end;
+	uint8_t * data;
+	uint32_t wrap;
+	uint32_t logic_length;
+	uint32_t peak_length;
+	uint32_t averages;
+	uint32_t spectrum_length;
+	uint8_t sample_bits;
+	app_buf_state_t state;
+	uint32_t seq;
+	uint32_t segments;
+	uint32_t segment_length;
+	bool stream;
+	measure_result_t measure;
+} rudimentary_buffer_t;
+
+
+// Configuration registers, mapped to the host at IF_VM_PIC_START
+typedef struct __attribute__((__packed__))
+{
+	uint32_t record_length;      // samples per frame or segment
+	uint32_t ring_depth;         // frames the arena holds, read only
+	uint32_t mode;               // APP_MODE_*, MIXED adds logic channels
+	uint32_t segment_count;      // segments per frame in segmented mode
+	uint32_t chunk_length;       // samples per chunk in roll mode
+	uint32_t flush_ms;           // roll mode: send partial chunks after this
+	uint32_t trigger_position;   // normal mode: percent of record pre-trigger
+	uint32_t decimation;         // normal mode: min/max buckets, 0 sends raw
+	uint32_t average_count;      // average mode: records per averaged frame
+	uint32_t average_bits;       // average mode: 8 or 16 bit result
+	uint32_t compression;        // CODEC_* for plain records, from next send
+	uint32_t measure;            // MEASURE_* bits, from the next capture
+	uint32_t spectrum_window;    // spectrum mode: FFT_WINDOW_*, next capture
+	uint32_t spectrum_format;    // spectrum mode: FFT_FORMAT_*, next capture
+	uint32_t qualify;            // QUALIFY_* records must pass to be queued
+	uint32_t qualify_level;      // threshold, sample code
+	uint32_t qualify_level2;     // runt: second threshold
+	uint32_t qualify_width;      // pulse or pattern width, samples
+	uint32_t qualify_pattern;    // pattern: QUALIFY_PATTERN_VALUE / _MASK
+	uint32_t hist_columns;       // histogram mode: columns, divides the record
+	uint32_t hist_rows;          // histogram mode: rows, power of two
+	uint32_t hist_waveforms;     // histogram mode: records binned, write clears
+	uint32_t mask_test;          // 1: queue only records outside the mask,
+	                             // a write clears the mask counts
+	uint32_t crc;                // 1: CRC-32 after sample data and register
+	                             // reads, from the next send (see crc.h)
+	uint32_t notify;             // IF_EVENT_* sent unasked as they happen
+	uint32_t sample_rate;        // Hz the FPGA samples at, for measured
+	                             // frequencies, 0 leaves them out
+} app_regs_t;                    // latched at the next arm
+
+// Statistics, readable by the host through IF_VM_STAT_START
+typedef struct __attribute__((__packed__))
+{
+	uint32_t capture_count;      // completed captures
+	uint32_t capture_errors;     // captures cut short by a DMA error
+	uint32_t capture_bytes;      // samples in the last capture
+	uint32_t capture_ticks;      // core timer ticks of the last capture
+	uint32_t capture_cpu_ticks;  // ticks the CPU spent servicing it
+	uint32_t capture_rate;       // bytes per second read out of the FPGA by
+	                             // the last capture, not its sample rate
+	uint16_t capture_load;       // CPU load during the last capture, 0.1 %
+	uint32_t frames_sent;        // frames handed to the interface
+	uint32_t frames_dropped;     // frames overwritten before they were sent
+	uint32_t wfm_rate;           // frames sent per second
+	uint32_t trig_rate;          // triggers captured per second
+	uint32_t trig_latency;       // trigger edge to first sample, core ticks
+	uint32_t trig_latency_min;
+	uint32_t trig_latency_max;
+	uint32_t stream_chunks;      // roll mode chunks sent
+	uint32_t stream_bytes;       // roll mode samples sent
+	uint32_t stream_rate;        // roll mode samples sent per second
+	uint32_t stream_flushes;     // chunks sent short by the flush interval
+	uint32_t chunk_gap;          // idle core ticks between the last chunks
+	uint32_t chunk_gap_max;
+	uint32_t avg_ticks;          // core ticks to accumulate the last record
+	uint32_t avg_cost;           // of that, 1/1000 core ticks per sample
+	uint32_t avg_rate;           // averaged frames completed per second
+	uint32_t codec_ratio;        // coded / raw size of the last record, 0.1 %
+	uint32_t codec_cost;         // coding time, 1/1000 core ticks per sample
+	uint32_t bench_ratio[BENCH_WAVES]; // codec on test waveforms at start up,
+	uint32_t bench_cost[BENCH_WAVES];  // same units, see bench.h
+	uint32_t meas_ticks;         // core ticks to measure the last record
+	uint32_t meas_cost;          // of that, 1/1000 core ticks per sample
+	uint32_t fft_ticks;          // core ticks for the last spectrum
+	uint32_t fft_bench[BENCH_FFT_SIZES]; // same at start up, 1K to 8K points
+	uint32_t qual_rejected;      // records dropped by the qualifier
+	uint32_t qual_ticks;         // core ticks to qualify the last record
+	uint32_t hist_ticks;         // core ticks to bin the last record
+	uint32_t hist_rate;          // records binned per second
+	uint32_t mask_pass;          // records inside the mask, not sent
+	uint32_t mask_fail;          // records outside it, queued
+	uint32_t mask_first;         // first sample out in the last failed one
+	uint32_t mask_ticks;         // core ticks to test the last record
+	uint32_t esc_ref[BENCH_WAVES];  // escaping at start up, byte at a time,
+	uint32_t esc_cost[BENCH_WAVES]; // and if_escape(), see bench_escape()
+	uint32_t crc_engine;         // 1: the DMA CRC engine passed its check
+	uint32_t crc_ticks;          // CPU core ticks on the last message's CRC
+	uint32_t trig_count;         // triggers captured since start up
+} app_stats_t;
+
+typedef struct
+{
+	app_states_t state;
+	uint32_t events;
+	
+	cdc_comms_t comms;
+	
+	bool blink_tick;
+	bool comms_tick;
+	
+	int8_t last_sample;
+	
+	SYS_TIME_HANDLE usb_timeout;
+	
+	app_regs_t regs;
+	app_regs_t active;
+	
+	rudimentary_buffer_t ring[APP_STREAM_DEPTH];
+	unsigned int ring_depth;
+	rudimentary_buffer_t * fill;
+	uint16_t * logic;            // mixed-signal port words, end of the arena
+	int16_t * fft_work;          // spectrum mode transform, end of the arena
+	
+	rudimentary_buffer_t acc_capture; // average and histogram mode capture,
+	                                  // not queued
+	uint16_t * avg_sums;
+	uint32_t * avg_wide;         // NULL if average_count fits 16 bit sums
+	uint32_t avg_done;
+	uint16_t * hist;             // histogram mode counters, column by column
+	uint32_t hist_size;          // bytes of them, read through IF_VM_HIST
+	bool hist_clear;             // host asked to clear, done at the next bin
+	bool mask_clear;             // same for the mask counts
+	uint32_t seq;
+	
+	uint32_t rate_tick;
+	uint32_t rate_captured;
+	uint32_t rate_sent;
+	uint32_t rate_stream;
+	uint32_t rate_averaged;
+	uint32_t rate_binned;
+	
+	uint32_t trigger_tick;
+	uint32_t seg_stamped;
+	
+	uint32_t chunk_tick;
+	uint32_t chunk_end_tick;
+	
+	bool stop_acq;
+	bool triggered;
+	
+	app_stats_t stats;
+} app_data_t;
+
+
+/*******************************************************************************
+  Function:
+    void APP_Initialize ( void )
+
+  Summary:
+     MPLAB Harmony application initialization routine.
+
+  Description:
+    This function initializes the Harmony application.  It places the 
+    application in its initial state and prepares it to run so that its 
+    APP_Tasks function can be called.
+
+  Precondition:
+    All other system initialization routines should be called before calling
+    this routine (in "SYS_Initialize").
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    APP_Initialize();
+    </code>
+
+  Remarks:
+    This routine must be called from the SYS_Initialize function.
+*/
+void APP_Initialize ( void );
+
+
+/*******************************************************************************
+  Function:
+    void APP_Tasks ( void )
+
+  Summary:
+    MPLAB Harmony application tasks function
+
+  Description:
+    This routine is the Harmony application's tasks function.  It
+    defines the application's state machine and core logic.
+
+  Precondition:
+    The system and application initialization ("SYS_Initialize") should be
+    called before calling this.
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    APP_Tasks();
+    </code>
+
+  Remarks:
+    This routine must be called from SYS_Tasks() routine.
+ */
+
+void APP_Tasks ( void );
+
+// Oldest captured frame, owned by the caller until released. NULL if none.
+rudimentary_buffer_t * APP_FrameAcquire ( void );
+void APP_FrameRelease ( rudimentary_buffer_t * frame );
+
+// True in roll mode, frames go out without a host request
+bool APP_Streaming ( void );
+
+// Host write to the configuration registers. False if a value is rejected.
+bool APP_RegsWrite ( uint32_t offset, const uint8_t * data, uint32_t length );
+
+
+extern cdc_comms_t * gp_comms;
+extern app_data_t appData;
+extern uint8_t app_mask[];
+extern TaskHandle_t xAPP_Tasks;
+
+
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif /* _APP_H */
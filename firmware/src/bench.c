@@ -0,0 +1,157 @@
+/*
+ * Built-in Benchmarks
+ *
+ * @Company
+ *   Probe-Scope Team
+ *
+ * @File Name
+ *   bench.c
+ *
+ * @Summary
+ *   Synthetic waveforms to measure the sample processing against
+*/
+
+#include "bench.h"
+
+#include "codec.h"
+#include "fft.h"
+#include "interface.h"
+#include "definitions.h"
+
+#include <stdint.h>
+
+
+void
+bench_wave (uint8_t * out, uint32_t length, unsigned int wave)
+{
+	// Sine from a rotating integer vector, about 200 samples a period and
+	// +-100 around mid scale. Square has the same period, noise is xorshift.
+	int32_t x = 100 << 8;
+	int32_t y = 0;
+	uint32_t r = 0x2545F491U;
+	uint32_t i;
+
+	for (i = 0; i < length; i++)
+	{
+		switch (wave)
+		{
+			case BENCH_SINE:
+				out[i] = (uint8_t) (128 + (y >> 8));
+				x -= y >> 5;
+				y += x >> 5;
+				break;
+
+			case BENCH_SQUARE:
+				out[i] = ((i / 100U) & 1U) ? 228 : 28;
+				break;
+
+			default:
+				r ^= r << 13;
+				r ^= r >> 17;
+				r ^= r << 5;
+				out[i] = (uint8_t) r;
+				break;
+		}
+	}
+}
+
+void
+bench_codec (uint8_t * scratch, uint32_t ratio[BENCH_WAVES],
+	uint32_t cost[BENCH_WAVES])
+{
+	uint8_t * out = scratch + BENCH_LENGTH;
+	unsigned int wave;
+
+	for (wave = 0; wave < BENCH_WAVES; wave++)
+	{
+		codec_state_t state;
+		uint32_t offset = 0;
+		uint32_t coded = 0;
+		uint32_t t0;
+
+		bench_wave(scratch, BENCH_LENGTH, wave);
+
+		t0 = CORETIMER_CounterGet();
+		codec_init(&state);
+		while (offset < BENCH_LENGTH)
+		{
+			uint32_t used;
+
+			coded += codec_encode(&state, &(scratch[offset]),
+				BENCH_LENGTH - offset, &used, out,
+				BENCH_CHUNK - CODEC_FLUSH_MAX);
+			offset += used;
+		}
+		coded += codec_flush(&state, out);
+
+		cost[wave] = (uint32_t) (((uint64_t) (CORETIMER_CounterGet() - t0)
+			* 1000U) / BENCH_LENGTH);
+		ratio[wave] = (uint32_t) (((uint64_t) coded * 1000U) / BENCH_LENGTH);
+	}
+}
+
+static unsigned int
+bench_escape_bytes (uint8_t * out, const uint8_t * in, unsigned int length)
+{
+	// if_escape() as it was, a compare chain per byte
+	unsigned int i, o = 0;
+
+	for (i = 0; i < length; i++)
+	{
+		uint8_t c = in[i];
+		if (IF_ESCAPE == c || IF_END_MESSAGE == c
+			|| IF_END_BLOCK == c || IF_START_MESSAGE == c)
+		{
+			out[o++] = IF_ESCAPE;
+		}
+
+		out[o++] = c;
+	}
+	return o;
+}
+
+void
+bench_escape (uint8_t * scratch, uint32_t ref[BENCH_WAVES],
+	uint32_t cost[BENCH_WAVES])
+{
+	uint8_t * out = scratch + BENCH_LENGTH;
+	unsigned int wave;
+
+	for (wave = 0; wave < BENCH_WAVES; wave++)
+	{
+		uint32_t t0;
+
+		bench_wave(scratch, BENCH_LENGTH, wave);
+
+		t0 = CORETIMER_CounterGet();
+		bench_escape_bytes(out, scratch, BENCH_LENGTH);
+		ref[wave] = (uint32_t) (((uint64_t) (CORETIMER_CounterGet() - t0)
+			* 1000U) / BENCH_LENGTH);
+
+		t0 = CORETIMER_CounterGet();
+		if_escape(out, scratch, BENCH_LENGTH);
+		cost[wave] = (uint32_t) (((uint64_t) (CORETIMER_CounterGet() - t0)
+			* 1000U) / BENCH_LENGTH);
+	}
+}
+
+void
+bench_fft (uint8_t * scratch, uint32_t ticks[BENCH_FFT_SIZES])
+{
+	int16_t * work = (int16_t *) (scratch + FFT_LENGTH_MAX);
+	uint32_t length = FFT_LENGTH_MIN;
+	unsigned int i;
+
+	for (i = 0; i < BENCH_FFT_SIZES; i++, length *= 2U)
+	{
+		uint32_t t0;
+
+		bench_wave(scratch, length, BENCH_SINE);
+
+		t0 = CORETIMER_CounterGet();
+		fft_load(work, scratch, length, FFT_WINDOW_HANN);
+		fft_run(work, length);
+		fft_bins(work, length, FFT_WINDOW_HANN, FFT_FORMAT_LINEAR, scratch);
+		ticks[i] = CORETIMER_CounterGet() - t0;
+	}
+}
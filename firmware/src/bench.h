@@ -0,0 +1,66 @@
+/*
+ * Built-in Benchmarks
+ *
+ * @Company
+ *   Probe-Scope Team
+ *
+ * @File Name
+ *   bench.h
+ *
+ * @Summary
+ *   Synthetic waveforms to measure the sample processing against
+*/
+
+#ifndef BENCH_H
+#define	BENCH_H
+
+
+#include <stdint.h>
+
+
+// Test waveforms
+#define BENCH_SINE   0
+#define BENCH_SQUARE 1
+#define BENCH_NOISE  2
+#define BENCH_WAVES  3
+
+// Samples per test record, and output room the codec runs into
+#define BENCH_LENGTH 8192U
+#define BENCH_CHUNK  4096U
+
+// Transform lengths timed, FFT_LENGTH_MIN doubling up to FFT_LENGTH_MAX
+#define BENCH_FFT_SIZES 4
+
+
+#ifdef	__cplusplus
+extern "C"
+{
+#endif
+
+
+// Fill length samples at out with a test waveform
+void bench_wave (uint8_t * out, uint32_t length, unsigned int wave);
+
+// Code each test waveform as the interface does, chunk by chunk. ratio
+// gets coded / raw size in 0.1 %, cost the time in 1/1000 core ticks per
+// sample. scratch takes BENCH_LENGTH + BENCH_CHUNK bytes.
+void bench_codec (uint8_t * scratch, uint32_t ratio[BENCH_WAVES],
+                  uint32_t cost[BENCH_WAVES]);
+
+// Escaping for the host link on each test waveform, in 1/1000 core ticks
+// per byte: the byte at a time loop it replaced in ref, if_escape() in
+// cost. scratch takes 3 * BENCH_LENGTH bytes.
+void bench_escape (uint8_t * scratch, uint32_t ref[BENCH_WAVES],
+                   uint32_t cost[BENCH_WAVES]);
+
+// Core ticks for the spectrum of a sine record, Hann window to linear
+// bins, at each length. scratch takes FFT_LENGTH_MAX bytes and the work
+// buffer, FFT_WORK_SIZE(FFT_LENGTH_MAX).
+void bench_fft (uint8_t * scratch, uint32_t ticks[BENCH_FFT_SIZES]);
+
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* BENCH_H */
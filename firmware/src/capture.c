@@ -0,0 +1,855 @@
+/*
+ * Sample Capture Engine
+ *
+ * @Company
+ *   Probe-Scope Team
+ *
+ * @File Name
+ *   capture.c
+ *
+ * @Summary
+ *   PMP + DMA transfer of FPGA samples into memory
+*/
+
+#include "capture.h"
+
+#include "definitions.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+// The PMP runs in master mode 2 with an 8-bit bus: FPP_D0..D7 (RE0..RE7) are
+// PMD0..PMD7 and the FPGA sample request is the PMRD strobe on FPP_NC1 (RD5).
+// Every completed read cycle pulses the PMP IRQ, which starts a one byte DMA
+// cell transfer out of PMDIN. Reading PMDIN starts the next read cycle, so
+// once primed the whole block runs without the CPU.
+//
+// That read-ahead means one cycle is always started and not yet collected.
+// The last byte of a transfer is therefore not left to the DMA, whose read
+// of it would strobe PMRD once more, but read by hand with the PMP off
+// (capture_last_byte()). Each transfer strobes PMRD once per byte it keeps.
+//
+// A transfer started after the buffer ready edge also watches FPIO2 fall,
+// as the read loop this replaced did before every byte. The FPGA has no
+// more samples then and the transfer stops where it is, with a short
+// record (capture_ready_lost()).
+//
+// The trigger (FPIO0) and buffer ready (FPIO2) lines raise change notice
+// interrupts. An armed line fires once on its next rising edge, with the
+// core timer latched at the top of the ISR, and is then disarmed again.
+//
+// In segmented mode the whole trigger / ready / transfer handshake for each
+// segment runs from these ISRs, so the FPGA is re-armed within microseconds
+// of the previous segment without waiting for the app task.
+//
+// For pre-trigger capture the channel runs round a ring of record size with
+// no end. The trigger stops it, notes where it was and lets it run on for
+// the post-trigger part only, so the ring then holds the record rotated by
+// capture_ring_stop() bytes.
+//
+// Mixed-signal captures start DMA channels 1 and 2 on the same PMP IRQ to
+// copy PORTB and PORTG next to every analog byte. They follow channel 0
+// block by block and are restarted with it.
+
+#define CAPTURE_TRIGGER_MASK (1U << 11)  // FPIO0 = RB11
+#define CAPTURE_READY_MASK   (1U << 4)   // FPIO2 = RF4
+
+typedef struct
+{
+	CAPTURE_CALLBACK callback;
+	uintptr_t        context;
+
+	uint8_t *        dest;     // ring base, the record for plain captures
+	uint32_t         size;     // ring size
+	uint32_t         offset;   // ring position of the first byte
+	uint32_t         length;   // bytes to transfer, 0 runs until triggered
+	uint32_t         done;
+	uint32_t         block;    // bytes the DMA moves in this block
+	bool             tail;     // and the last byte follows by hand
+	uint16_t *       logic;    // PORTB words then PORTG words, or NULL
+
+	uint32_t         start_tick;
+	capture_stats_t  stats;
+
+	volatile bool    busy;
+	bool             ready_watch;  // FPIO2 falling stops the transfer
+
+	uint8_t *        seg_dest;
+	uint64_t *       seg_stamps;
+	uint32_t         seg_length;
+	uint32_t         seg_count;
+	volatile uint32_t seg_done;
+	volatile bool    seg_active;
+
+	uint32_t         ring_pre;
+	volatile bool    ring_active;
+	volatile bool    ring_wait;
+
+	CAPTURE_EDGE_CALLBACK edge_callback;
+	uintptr_t             edge_context;
+	volatile uint32_t     edge_tick[CAPTURE_EDGE_COUNT];
+} capture_data_t;
+
+static capture_data_t capture_data;
+
+
+static bool capture_block_start (void);
+static void capture_block_restart (void);
+static void capture_last_byte   (void);
+static void capture_stop        (void);
+static void capture_ready_lost  (void);
+static void capture_finish      (bool error);
+static void capture_edge_fire   (capture_edge_t edge, uint32_t tick);
+static void capture_seg_arm     (void);
+static void capture_seg_edge    (capture_edge_t edge, uint32_t tick);
+static void capture_dma_start   (void);
+static void capture_ring_trigger(void);
+
+
+void
+capture_init (void)
+{
+	capture_data.callback = NULL;
+	capture_data.context = 0;
+	capture_data.busy = false;
+	capture_data.ready_watch = false;
+	capture_data.seg_active = false;
+	capture_data.ring_active = false;
+
+	FPIO0_InputEnable(); // trigger
+	FPIO1_OutputEnable(); // pic ready
+	FPIO2_InputEnable(); // fpga ready
+	FPIO3_InputEnable(); // logic channels
+	FPIO4_InputEnable();
+	EXIO0_InputEnable();
+	EXIO1_InputEnable();
+	EXIO2_InputEnable();
+	EXIO3_InputEnable();
+
+	// PMRD is held low by the port while the PMP is off
+	FPP_NC1_Clear();
+	FPP_NC1_OutputEnable();
+
+	// PMP: master mode 2, 8 bit, IRQ at the end of every read cycle,
+	// active high read strobe, no address or chip select lines
+	PMCON = 0;
+	PMAEN = 0;
+	PMMODE = (0x2U << _PMMODE_MODE_POSITION)
+		| (0x1U << _PMMODE_IRQM_POSITION)
+		| (CAPTURE_PMP_WAITB << _PMMODE_WAITB_POSITION)
+		| (CAPTURE_PMP_WAITM << _PMMODE_WAITM_POSITION)
+		| (CAPTURE_PMP_WAITE << _PMMODE_WAITE_POSITION);
+	PMCON = _PMCON_PTRDEN_MASK | _PMCON_RDSP_MASK;
+	PMCONSET = _PMCON_ON_MASK;
+
+	// DMA channel 0: PMDIN -> sample memory, started by the PMP IRQ
+	DMACONSET = _DMACON_ON_MASK;
+	DCH0CON = (0x3U << _DCH0CON_CHPRI_POSITION);
+	DCH0ECON = (INT_SOURCE_PMP << _DCH0ECON_CHSIRQ_POSITION)
+		| _DCH0ECON_SIRQEN_MASK;
+	DCH0INT = 0;
+	DCH0SSA = KVA_TO_PA(&PMDIN);
+	DCH0SSIZ = 1;
+	DCH0CSIZ = 1;
+
+	EVIC_SourceStatusClear(INT_SOURCE_DMA0);
+	EVIC_SourceEnable(INT_SOURCE_DMA0);
+
+	// DMA channels 1 and 2: PORTB / PORTG -> logic buffer on the same IRQ,
+	// no interrupts, channel 0 paces them
+	capture_data.logic = NULL;
+	DCH1CON = (0x2U << _DCH1CON_CHPRI_POSITION);
+	DCH1ECON = (INT_SOURCE_PMP << _DCH1ECON_CHSIRQ_POSITION)
+		| _DCH1ECON_SIRQEN_MASK;
+	DCH1INT = 0;
+	DCH1SSA = KVA_TO_PA(&PORTB);
+	DCH1SSIZ = sizeof(uint16_t);
+	DCH1CSIZ = sizeof(uint16_t);
+	DCH2CON = (0x2U << _DCH2CON_CHPRI_POSITION);
+	DCH2ECON = (INT_SOURCE_PMP << _DCH2ECON_CHSIRQ_POSITION)
+		| _DCH2ECON_SIRQEN_MASK;
+	DCH2INT = 0;
+	DCH2SSA = KVA_TO_PA(&PORTG);
+	DCH2SSIZ = sizeof(uint16_t);
+	DCH2CSIZ = sizeof(uint16_t);
+
+	// Change notice in mismatch mode, pins enabled only while armed
+	capture_data.edge_callback = NULL;
+	capture_data.edge_context = 0;
+	CNENBCLR = CAPTURE_TRIGGER_MASK;
+	CNENFCLR = CAPTURE_READY_MASK;
+	CNCONBSET = _CNCONB_ON_MASK;
+	CNCONFSET = _CNCONF_ON_MASK;
+	EVIC_SourceStatusClear(INT_SOURCE_CHANGE_NOTICE_B);
+	EVIC_SourceStatusClear(INT_SOURCE_CHANGE_NOTICE_F);
+	EVIC_SourceEnable(INT_SOURCE_CHANGE_NOTICE_B);
+	EVIC_SourceEnable(INT_SOURCE_CHANGE_NOTICE_F);
+}
+
+void
+capture_callback_register (CAPTURE_CALLBACK callback, uintptr_t context)
+{
+	capture_data.callback = callback;
+	capture_data.context = context;
+}
+
+void
+capture_ready (bool ready)
+{
+	if (ready)
+	{
+		FPIO1_Set();
+	}
+	else
+	{
+		FPIO1_Clear();
+	}
+}
+
+bool
+capture_start (uint8_t * dest, uint32_t length)
+{
+	if (capture_data.busy || 0 == length)
+	{
+		return false;
+	}
+
+	capture_data.dest = dest;
+	capture_data.size = length;
+	capture_data.offset = 0;
+	capture_data.length = length;
+	capture_data.logic = NULL;
+	capture_data.ready_watch = true;
+	capture_dma_start();
+	return true;
+}
+
+bool
+capture_mixed_start (uint8_t * dest, uint16_t * logic, uint32_t length)
+{
+	// As capture_start, logic takes CAPTURE_LOGIC_RAW(length) bytes of
+	// port words for capture_logic_pack()
+	if (capture_data.busy || 0 == length)
+	{
+		return false;
+	}
+
+	capture_data.dest = dest;
+	capture_data.size = length;
+	capture_data.offset = 0;
+	capture_data.length = length;
+	capture_data.logic = logic;
+	capture_data.ready_watch = true;
+	capture_dma_start();
+	return true;
+}
+
+bool
+capture_ring_start (uint8_t * dest, uint32_t length, uint32_t pre)
+{
+	// Run round dest until pre bytes are in and a trigger comes, then
+	// capture length - pre more. The callback runs when that is done.
+	if (capture_busy() || 0 == length || pre >= length)
+	{
+		return false;
+	}
+
+	capture_data.dest = dest;
+	capture_data.size = length;
+	capture_data.offset = 0;
+	capture_data.length = 0;
+	capture_data.logic = NULL;
+	capture_data.ready_watch = false;
+	capture_data.ring_pre = pre;
+	capture_data.ring_wait = 0 != pre;
+	capture_data.ring_active = true;
+	capture_dma_start();
+
+	if (!capture_data.ring_wait)
+	{
+		// No history wanted, take the trigger straight away. Hold the DMA
+		// ISR off so it cannot chain a block under capture_ring_trigger().
+		EVIC_SourceDisable(INT_SOURCE_DMA0);
+		if (capture_edge_arm(CAPTURE_EDGE_TRIGGER))
+		{
+			capture_ring_trigger();
+		}
+		EVIC_SourceEnable(INT_SOURCE_DMA0);
+	}
+	return true;
+}
+
+uint32_t
+capture_ring_stop (void)
+{
+	// Ring position of the oldest byte once a ring capture is done
+	return (capture_data.offset + capture_data.done) % capture_data.size;
+}
+
+void
+capture_abort (void)
+{
+	if (capture_data.seg_active)
+	{
+		capture_data.seg_active = false;
+		capture_edge_disarm(CAPTURE_EDGE_TRIGGER);
+		capture_edge_disarm(CAPTURE_EDGE_READY);
+		capture_ready(false);
+	}
+
+	if (capture_data.ring_active)
+	{
+		capture_data.ring_active = false;
+		capture_edge_disarm(CAPTURE_EDGE_TRIGGER);
+	}
+
+	if (!capture_data.busy)
+	{
+		return;
+	}
+
+	// The ISRs stay off while the channels are taken apart
+	EVIC_SourceDisable(INT_SOURCE_DMA0);
+	EVIC_SourceDisable(INT_SOURCE_CHANGE_NOTICE_F);
+	capture_stop();
+	EVIC_SourceEnable(INT_SOURCE_DMA0);
+	EVIC_SourceEnable(INT_SOURCE_CHANGE_NOTICE_F);
+
+	capture_data.stats.bytes = capture_data.done;
+	capture_data.stats.ticks = CORETIMER_CounterGet()
+		- capture_data.start_tick;
+	capture_data.busy = false;
+}
+
+bool
+capture_busy (void)
+{
+	return capture_data.busy || capture_data.seg_active
+		|| capture_data.ring_active;
+}
+
+void
+capture_stats_get (capture_stats_t * stats)
+{
+	*stats = capture_data.stats;
+}
+
+bool
+capture_segments_start (uint8_t * dest, uint32_t length, uint32_t count,
+	uint64_t * stamps)
+{
+	// count records of length bytes back to back at dest, each behind its
+	// own trigger. stamps[i] gets the core timer at the trigger of segment
+	// i. The callback runs after every segment, check capture_segments_done.
+	if (capture_busy() || 0 == length || 0 == count)
+	{
+		return false;
+	}
+
+	capture_data.seg_dest = dest;
+	capture_data.seg_stamps = stamps;
+	capture_data.seg_length = length;
+	capture_data.seg_count = count;
+	capture_data.seg_done = 0;
+	capture_data.seg_active = true;
+
+	capture_seg_arm();
+	return true;
+}
+
+uint32_t
+capture_segments_done (void)
+{
+	return capture_data.seg_done;
+}
+
+void
+capture_edge_callback_register (CAPTURE_EDGE_CALLBACK callback,
+	uintptr_t context)
+{
+	capture_data.edge_callback = callback;
+	capture_data.edge_context = context;
+}
+
+bool
+capture_edge_arm (capture_edge_t edge)
+{
+	// Enable the line and take the port as the mismatch reference. If it
+	// is already high the edge was missed: latch it now and return true,
+	// no interrupt will follow. The CN interrupt is held off meanwhile so
+	// an edge is reported exactly once, either here or from the ISR.
+	INT_SOURCE source;
+	bool enabled;
+	uint32_t level;
+
+	if (CAPTURE_EDGE_TRIGGER == edge)
+	{
+		source = INT_SOURCE_CHANGE_NOTICE_B;
+		enabled = EVIC_SourceIsEnabled(source);
+		EVIC_SourceDisable(source);
+		CNENBSET = CAPTURE_TRIGGER_MASK;
+		level = PORTB & CAPTURE_TRIGGER_MASK;
+	}
+	else
+	{
+		source = INT_SOURCE_CHANGE_NOTICE_F;
+		enabled = EVIC_SourceIsEnabled(source);
+		EVIC_SourceDisable(source);
+		CNENFSET = CAPTURE_READY_MASK;
+		level = PORTF & CAPTURE_READY_MASK;
+	}
+
+	if (level)
+	{
+		capture_edge_disarm(edge);
+		capture_data.edge_tick[edge] = CORETIMER_CounterGet();
+	}
+
+	if (enabled)
+	{
+		EVIC_SourceEnable(source);
+	}
+
+	return 0 != level;
+}
+
+void
+capture_edge_disarm (capture_edge_t edge)
+{
+	if (CAPTURE_EDGE_TRIGGER == edge)
+	{
+		CNENBCLR = CAPTURE_TRIGGER_MASK;
+		(void) PORTB;
+		EVIC_SourceStatusClear(INT_SOURCE_CHANGE_NOTICE_B);
+	}
+	else
+	{
+		CNENFCLR = CAPTURE_READY_MASK;
+		(void) PORTF;
+		EVIC_SourceStatusClear(INT_SOURCE_CHANGE_NOTICE_F);
+	}
+}
+
+uint32_t
+capture_edge_tick (capture_edge_t edge)
+{
+	return capture_data.edge_tick[edge];
+}
+
+
+static void
+capture_dma_start (void)
+{
+	uint32_t t0 = CORETIMER_CounterGet();
+
+	capture_data.done = 0;
+	capture_data.stats.bytes = 0;
+	capture_data.stats.cpu_ticks = 0;
+	capture_data.stats.error = false;
+	capture_data.stats.start_tick = t0;
+	capture_data.start_tick = t0;
+	capture_data.busy = true;
+
+	if (capture_data.ready_watch)
+	{
+		// Watch FPIO2 from here, the read of the port is the mismatch
+		// reference. Low already means the FPGA has nothing to give.
+		CNENFSET = CAPTURE_READY_MASK;
+		if (0 == (PORTF & CAPTURE_READY_MASK))
+		{
+			capture_finish(false);
+			return;
+		}
+	}
+
+	DCH0INTCLR = 0x00FF00FF;
+	DCH0INTSET = _DCH0INT_CHBCIE_MASK | _DCH0INT_CHERIE_MASK;
+
+	// Prime the pipeline: this dummy read starts the first bus cycle
+	EVIC_SourceStatusClear(INT_SOURCE_PMP);
+	if (capture_block_start())
+	{
+		(void) PMDIN;
+	}
+	else
+	{
+		// Just the last byte, its cycle is the one primed
+		(void) PMDIN;
+		capture_last_byte();
+		capture_finish(false);
+	}
+
+	capture_data.stats.cpu_ticks += CORETIMER_CounterGet() - t0;
+}
+
+static bool
+capture_block_start (void)
+{
+	// Next block runs to the end of the ring, the end of the transfer or
+	// CAPTURE_BLOCK_MAX, whichever comes first. The DMA leaves the last
+	// byte of the transfer to capture_last_byte(), false if that byte is
+	// all there is to the block.
+	uint32_t pos = (capture_data.offset + capture_data.done)
+		% capture_data.size;
+	uint32_t left = capture_data.length - capture_data.done;
+	uint32_t block = capture_data.size - pos;
+
+	if (capture_data.length && block > left)
+	{
+		block = left;
+	}
+	if (block > CAPTURE_BLOCK_MAX)
+	{
+		block = CAPTURE_BLOCK_MAX;
+	}
+	if (NULL != capture_data.logic && block > CAPTURE_LOGIC_BLOCK_MAX)
+	{
+		// Two bytes per sample and channel
+		block = CAPTURE_LOGIC_BLOCK_MAX;
+	}
+	capture_data.tail = capture_data.length && block == left;
+
+	if (NULL != capture_data.logic)
+	{
+		// The port channels take the last byte's words too, and may still
+		// be finishing the last cell of the previous block
+		while ((DCH1CON | DCH2CON) & _DCH1CON_CHEN_MASK);
+
+		DCH1DSA = KVA_TO_PA(capture_data.logic + pos);
+		DCH1DSIZ = block * sizeof(uint16_t);
+		DCH2DSA = KVA_TO_PA(capture_data.logic + capture_data.size + pos);
+		DCH2DSIZ = block * sizeof(uint16_t);
+		DCH1CONSET = _DCH1CON_CHEN_MASK;
+		DCH2CONSET = _DCH2CON_CHEN_MASK;
+	}
+
+	capture_data.block = capture_data.tail ? block - 1U : block;
+	if (0 == capture_data.block)
+	{
+		return false;
+	}
+	DCH0DSA = KVA_TO_PA(capture_data.dest + pos);
+	DCH0DSIZ = capture_data.block;
+	DCH0CONSET = _DCH0CON_CHEN_MASK;
+	return true;
+}
+
+static void
+capture_block_restart (void)
+{
+	bool dma = capture_block_start();
+
+	// The read cycle started by the last cell of the previous block
+	// completed while the channel was disabled, so its IRQ was
+	// missed. Collect that byte by hand to restart the chain.
+	while (PMMODE & _PMMODE_BUSY_MASK);
+	if (NULL != capture_data.logic)
+	{
+		DCH1ECONSET = _DCH1ECON_CFORCE_MASK;
+		DCH2ECONSET = _DCH2ECON_CFORCE_MASK;
+	}
+	if (dma)
+	{
+		DCH0ECONSET = _DCH0ECON_CFORCE_MASK;
+	}
+	else
+	{
+		capture_last_byte();
+		capture_finish(false);
+	}
+}
+
+static void
+capture_last_byte (void)
+{
+	// The cycle started by the last DMA read (or the priming read) holds
+	// the last byte. With the PMP off reading PMDIN strobes nothing.
+	uint32_t pos = (capture_data.offset + capture_data.done)
+		% capture_data.size;
+
+	while (PMMODE & _PMMODE_BUSY_MASK);
+	PMCONCLR = _PMCON_ON_MASK;
+	capture_data.dest[pos] = (uint8_t) PMDIN;
+	PMCONSET = _PMCON_ON_MASK;
+	EVIC_SourceStatusClear(INT_SOURCE_PMP);
+	capture_data.done++;
+}
+
+static void
+capture_stop (void)
+{
+	// Stop the channels where they are and take the byte of the read cycle
+	// still out, so the FPGA is not strobed for a byte that is dropped
+	uint32_t dptr;
+
+	DCH0CONCLR = _DCH0CON_CHEN_MASK;
+	while (DCH0CON & _DCH0CON_CHBUSY_MASK);
+
+	// A block that just ended has reset the pointer already
+	dptr = (DCH0INT & _DCH0INT_CHBCIF_MASK) ? capture_data.block : DCH0DPTR;
+	capture_data.done += dptr;
+	DCH0ECONSET = _DCH0ECON_CABORT_MASK;
+	DCH0INTCLR = 0x00FF00FF;
+	EVIC_SourceStatusClear(INT_SOURCE_DMA0);
+
+	if (NULL != capture_data.logic)
+	{
+		// Let the port channels catch up with channel 0, then read the
+		// ports for the last byte by hand, a little late
+		uint32_t pos = (capture_data.offset + capture_data.done)
+			% capture_data.size;
+
+		while (((DCH1CON & _DCH1CON_CHEN_MASK)
+			&& DCH1DPTR < dptr * sizeof(uint16_t))
+			|| ((DCH2CON & _DCH2CON_CHEN_MASK)
+			&& DCH2DPTR < dptr * sizeof(uint16_t)));
+		DCH1CONCLR = _DCH1CON_CHEN_MASK;
+		DCH2CONCLR = _DCH2CON_CHEN_MASK;
+		capture_data.logic[pos] = (uint16_t) PORTB;
+		capture_data.logic[capture_data.size + pos] = (uint16_t) PORTG;
+	}
+
+	capture_last_byte();
+}
+
+static void
+capture_ready_lost (void)
+{
+	// FPIO2 fell, the FPGA has no more samples. The record ends here.
+	capture_stop();
+	capture_finish(false);
+}
+
+static void
+capture_ring_trigger (void)
+{
+	// Freeze the pre-trigger history where it is and capture only the
+	// post-trigger part from here on
+	uint32_t post = capture_data.size - capture_data.ring_pre;
+	uint32_t dptr;
+
+	DCH0CONCLR = _DCH0CON_CHEN_MASK;
+	while (DCH0CON & _DCH0CON_CHBUSY_MASK);
+
+	// A block that just ended has reset the pointer already
+	dptr = (DCH0INT & _DCH0INT_CHBCIF_MASK) ? capture_data.block : DCH0DPTR;
+	capture_data.offset = (capture_data.offset + capture_data.done + dptr)
+		% capture_data.size;
+	capture_data.done = 0;
+	capture_data.length = post;
+	capture_data.ring_active = false;
+	capture_data.start_tick = CORETIMER_CounterGet();
+
+	DCH0INTCLR = 0x000000FF;
+	capture_block_restart();
+}
+
+static void
+capture_finish (bool error)
+{
+	if (NULL != capture_data.logic && !error)
+	{
+		// Let the port channels store the word of the last sample
+		while ((DCH1CON | DCH2CON) & _DCH1CON_CHEN_MASK);
+	}
+
+	DCH0CONCLR = _DCH0CON_CHEN_MASK;
+	DCH1CONCLR = _DCH1CON_CHEN_MASK;
+	DCH2CONCLR = _DCH2CON_CHEN_MASK;
+
+	if (capture_data.ready_watch)
+	{
+		capture_data.ready_watch = false;
+		capture_edge_disarm(CAPTURE_EDGE_READY);
+	}
+
+	capture_data.stats.bytes = capture_data.done;
+	capture_data.stats.error = error;
+	capture_data.stats.ticks = CORETIMER_CounterGet()
+		- capture_data.start_tick;
+	capture_data.busy = false;
+
+	if (capture_data.seg_active)
+	{
+		// Re-arm for the next segment before anything else
+		capture_ready(false);
+		capture_data.seg_done++;
+		if (error || capture_data.seg_done >= capture_data.seg_count)
+		{
+			capture_data.seg_active = false;
+		}
+		else
+		{
+			capture_seg_arm();
+		}
+	}
+
+	if (NULL != capture_data.callback)
+	{
+		capture_data.callback(capture_data.context);
+	}
+}
+
+static void
+capture_seg_arm (void)
+{
+	if (capture_edge_arm(CAPTURE_EDGE_TRIGGER))
+	{
+		capture_seg_edge(CAPTURE_EDGE_TRIGGER,
+			capture_data.edge_tick[CAPTURE_EDGE_TRIGGER]);
+	}
+}
+
+static void
+capture_seg_edge (capture_edge_t edge, uint32_t tick)
+{
+	if (CAPTURE_EDGE_TRIGGER == edge)
+	{
+		capture_data.seg_stamps[capture_data.seg_done] = tick;
+
+		// Same handshake as the app: arm ready, then tell the FPGA
+		bool ready = capture_edge_arm(CAPTURE_EDGE_READY);
+
+		capture_ready(true);
+		if (ready)
+		{
+			capture_seg_edge(CAPTURE_EDGE_READY,
+				capture_data.edge_tick[CAPTURE_EDGE_READY]);
+		}
+	}
+	else
+	{
+		capture_start(capture_data.seg_dest
+			+ capture_data.seg_done * capture_data.seg_length,
+			capture_data.seg_length);
+	}
+}
+
+static void
+capture_edge_fire (capture_edge_t edge, uint32_t tick)
+{
+	capture_data.edge_tick[edge] = tick;
+	capture_edge_disarm(edge);
+
+	if (capture_data.seg_active)
+	{
+		capture_seg_edge(edge, tick);
+	}
+	else if (capture_data.ring_active)
+	{
+		// Triggers before the pre-trigger part is full are ignored, the
+		// DMA ISR arms the line again once it is
+		if (CAPTURE_EDGE_TRIGGER == edge && !capture_data.ring_wait)
+		{
+			capture_ring_trigger();
+		}
+	}
+	else if (NULL != capture_data.edge_callback)
+	{
+		capture_data.edge_callback(edge, capture_data.edge_context);
+	}
+}
+
+void
+DMA0_InterruptHandler (void)
+{
+	uint32_t t0 = CORETIMER_CounterGet();
+	uint32_t flags = DCH0INT;
+
+	DCH0INTCLR = 0x000000FF;
+	EVIC_SourceStatusClear(INT_SOURCE_DMA0);
+
+	if (!capture_data.busy)
+	{
+		return;
+	}
+
+	if (flags & _DCH0INT_CHERIF_MASK)
+	{
+		capture_data.done += DCH0DPTR;
+		capture_finish(true);
+	}
+	else if (flags & _DCH0INT_CHBCIF_MASK)
+	{
+		capture_data.done += capture_data.block;
+
+		if (0 == capture_data.length)
+		{
+			// Free running ring, look for the trigger once the pre-trigger
+			// part is full. Keep done from growing without bound.
+			capture_block_restart();
+
+			if (capture_data.done >= capture_data.size)
+			{
+				capture_data.done -= capture_data.size;
+				capture_data.ring_wait = false;
+			}
+			if (capture_data.ring_wait
+				&& capture_data.done >= capture_data.ring_pre)
+			{
+				capture_data.ring_wait = false;
+			}
+			if (!capture_data.ring_wait && capture_data.ring_active
+				&& !(CNENB & CAPTURE_TRIGGER_MASK))
+			{
+				if (capture_edge_arm(CAPTURE_EDGE_TRIGGER))
+				{
+					capture_ring_trigger();
+				}
+			}
+		}
+		else if (capture_data.tail)
+		{
+			capture_last_byte();
+			capture_finish(false);
+		}
+		else
+		{
+			capture_block_restart();
+		}
+	}
+
+	capture_data.stats.cpu_ticks += CORETIMER_CounterGet() - t0;
+}
+
+void
+CHANGE_NOTICE_B_InterruptHandler (void)
+{
+	uint32_t tick = CORETIMER_CounterGet();
+	uint32_t status = CNSTATB;
+	uint32_t port = PORTB;  // ends the mismatch
+
+	EVIC_SourceStatusClear(INT_SOURCE_CHANGE_NOTICE_B);
+
+	if ((status & CAPTURE_TRIGGER_MASK) && (port & CAPTURE_TRIGGER_MASK)
+		&& (CNENB & CAPTURE_TRIGGER_MASK))
+	{
+		capture_edge_fire(CAPTURE_EDGE_TRIGGER, tick);
+	}
+}
+
+void
+CHANGE_NOTICE_F_InterruptHandler (void)
+{
+	uint32_t tick = CORETIMER_CounterGet();
+	uint32_t status = CNSTATF;
+	uint32_t port = PORTF;  // ends the mismatch
+
+	EVIC_SourceStatusClear(INT_SOURCE_CHANGE_NOTICE_F);
+
+	if (capture_data.ready_watch)
+	{
+		if ((status & CAPTURE_READY_MASK) && !(port & CAPTURE_READY_MASK)
+			&& capture_data.busy)
+		{
+			capture_ready_lost();
+		}
+	}
+	else if ((status & CAPTURE_READY_MASK) && (port & CAPTURE_READY_MASK)
+		&& (CNENF & CAPTURE_READY_MASK))
+	{
+		capture_edge_fire(CAPTURE_EDGE_READY, tick);
+	}
+}
@@ -0,0 +1,127 @@
+/*
+ * Sample Capture Engine
+ *
+ * @Company
+ *   Probe-Scope Team
+ *
+ * @File Name
+ *   capture.h
+ *
+ * @Summary
+ *   PMP + DMA transfer of FPGA samples into memory
+*/
+
+#ifndef CAPTURE_H
+#define	CAPTURE_H
+
+// This is everything the app knows of the FPGA front end: the handshake
+// lines, sample transfer and the capture sequencers. capture.c implements
+// it on the PIC32, capture_sim.c models the FPGA on a host so the app
+// state machine can run and be profiled off the board.
+
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+// DCHxDSIZ is only 16 bits wide, longer records are chained block by block
+#define CAPTURE_BLOCK_MAX 0x8000U
+
+// PMP read strobe timing in PBCLK2 cycles (see PMMODE WAITB/WAITM/WAITE).
+// The FPGA must present data on FPP_D0..D7 before the end of WAITM. It
+// sees one PMRD strobe per byte a transfer keeps, none past the record.
+//
+// A capture_start() or capture_mixed_start() transfer runs while FPIO2
+// (buffer ready) is high and ends short when it falls, as the FPGA has no
+// more samples. It stops within the change notice latency, so the FPGA
+// drops FPIO2 while it can still answer the strobes of that time, a few
+// microseconds. Ring captures do not look at FPIO2, the FPGA streams to
+// them for as long as FPIO1 is high.
+#define CAPTURE_PMP_WAITB 0U
+#define CAPTURE_PMP_WAITM 3U
+#define CAPTURE_PMP_WAITE 0U
+
+// Mixed-signal capture: EXIO0..EXIO3, FPIO3 and FPIO4 are logic channels
+// 0..5. Their ports are sampled with every analog byte, two 16 bit words
+// per sample, and packed to one bit plane per channel afterwards.
+#define CAPTURE_LOGIC_CHANNELS  6U
+#define CAPTURE_LOGIC_PLANE(n)  (((n) + 7U) / 8U)
+#define CAPTURE_LOGIC_RAW(n)    ((n) * 2U * sizeof(uint16_t))
+#define CAPTURE_LOGIC_BLOCK_MAX (CAPTURE_BLOCK_MAX / 2U)
+
+// Logic channel bit positions in the PORTB and PORTG words
+#define CAPTURE_EXIO0_BIT 5   // RB5
+#define CAPTURE_EXIO1_BIT 6   // RB6
+#define CAPTURE_EXIO2_BIT 9   // RB9
+#define CAPTURE_EXIO3_BIT 13  // RB13
+#define CAPTURE_FPIO3_BIT 6   // RG6
+#define CAPTURE_FPIO4_BIT 9   // RG9
+
+
+#ifdef	__cplusplus
+extern "C"
+{
+#endif
+
+
+// FPGA handshake lines watched by change notification
+typedef enum
+{
+	CAPTURE_EDGE_TRIGGER = 0,  // FPIO0, trigger out
+	CAPTURE_EDGE_READY,        // FPIO2, buffer ready
+	CAPTURE_EDGE_COUNT
+} capture_edge_t;
+
+typedef void (*CAPTURE_CALLBACK) (uintptr_t context);
+typedef void (*CAPTURE_EDGE_CALLBACK) (capture_edge_t edge, uintptr_t context);
+
+typedef struct
+{
+	uint32_t bytes;      // bytes transferred by the last capture
+	uint32_t start_tick; // core timer when the first sample was strobed
+	uint32_t ticks;      // core timer ticks from start to completion
+	uint32_t cpu_ticks;  // core timer ticks spent in start + DMA ISRs
+	bool     error;      // DMA address error, capture is incomplete
+} capture_stats_t;
+
+
+void capture_init              (void);
+void capture_callback_register (CAPTURE_CALLBACK callback, uintptr_t context);
+
+// FPIO1, tells the FPGA the PIC is ready to take the buffer
+void capture_ready (bool ready);
+
+bool capture_start (uint8_t * dest, uint32_t length);
+bool capture_mixed_start (uint8_t * dest, uint16_t * logic, uint32_t length);
+void capture_abort (void);
+bool capture_busy  (void);
+
+bool     capture_ring_start (uint8_t * dest, uint32_t length, uint32_t pre);
+uint32_t capture_ring_stop  (void);
+
+void capture_stats_get (capture_stats_t * stats);
+
+void capture_logic_pack (uint8_t * planes, const uint16_t * logic,
+                         uint32_t length);
+
+bool     capture_segments_start (uint8_t * dest, uint32_t length,
+                                 uint32_t count, uint64_t * stamps);
+uint32_t capture_segments_done  (void);
+
+void     capture_edge_callback_register (CAPTURE_EDGE_CALLBACK callback,
+                                         uintptr_t context);
+bool     capture_edge_arm    (capture_edge_t edge);
+void     capture_edge_disarm (capture_edge_t edge);
+uint32_t capture_edge_tick   (capture_edge_t edge);
+
+void DMA0_InterruptHandler (void);
+void CHANGE_NOTICE_B_InterruptHandler (void);
+void CHANGE_NOTICE_F_InterruptHandler (void);
+
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* CAPTURE_H */
@@ -0,0 +1,47 @@
+/*
+ * Logic Channel Packing
+ *
+ * @Company
+ *   Probe-Scope Team
+ *
+ * @File Name
+ *   capture_logic.c
+ *
+ * @Summary
+ *   Bit plane packing of mixed-signal captures, shared by both front ends
+*/
+
+#include "capture.h"
+
+#include <stdint.h>
+#include <string.h>
+
+
+void
+capture_logic_pack (uint8_t * planes, const uint16_t * logic, uint32_t length)
+{
+	// Port words of a mixed-signal capture of length samples to bit planes:
+	// CAPTURE_LOGIC_CHANNELS planes of CAPTURE_LOGIC_PLANE(length) bytes,
+	// sample n of a channel in bit n % 8 of byte n / 8 of its plane
+	const uint16_t * portb = logic;
+	const uint16_t * portg = logic + length;
+	uint32_t plane = CAPTURE_LOGIC_PLANE(length);
+	uint32_t i;
+
+	memset(planes, 0, plane * CAPTURE_LOGIC_CHANNELS);
+
+	for (i = 0; i < length; i++)
+	{
+		uint32_t b = portb[i];
+		uint32_t g = portg[i];
+		uint32_t bit = i & 7U;
+		uint8_t * p = planes + (i >> 3);
+
+		p[0]         |= ((b >> CAPTURE_EXIO0_BIT) & 1U) << bit;
+		p[plane]     |= ((b >> CAPTURE_EXIO1_BIT) & 1U) << bit;
+		p[plane * 2] |= ((b >> CAPTURE_EXIO2_BIT) & 1U) << bit;
+		p[plane * 3] |= ((b >> CAPTURE_EXIO3_BIT) & 1U) << bit;
+		p[plane * 4] |= ((g >> CAPTURE_FPIO3_BIT) & 1U) << bit;
+		p[plane * 5] |= ((g >> CAPTURE_FPIO4_BIT) & 1U) << bit;
+	}
+}
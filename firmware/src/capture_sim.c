@@ -0,0 +1,558 @@
+/*
+ * Simulated FPGA Front End
+ *
+ * @Company
+ *   Probe-Scope Team
+ *
+ * @File Name
+ *   capture_sim.c
+ *
+ * @Summary
+ *   Host model of the FPGA behind the capture.h interface
+*/
+
+#include "capture_sim.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+
+// Stands in for capture.c in host builds, it is not part of the firmware
+// project. Everything runs in simulated time, moved on by
+// capture_sim_advance(). While a transfer runs the FPGA delivers a sample
+// every 1 / sample_rate seconds. It raises the trigger line after each
+// interval of the trigger pattern, and the ready line ready_latency ticks
+// after the PIC says it is ready. With ready_length set it falls again
+// after that many samples, which ends a transfer short.
+//
+// Samples are the low byte of a running sample count and logic channel n
+// toggles every 2^n samples, so a harness can check what arrives. The
+// sequencers behave as the ISR driven ones in capture.c do.
+
+typedef struct
+{
+	capture_sim_config_t config;
+	uint64_t         now;
+	uint64_t         samples;       // delivered since capture_init
+
+	uint64_t         next_trigger;
+	uint32_t         pattern_pos;
+	uint64_t         trigger_high;  // trigger line is high until then
+	uint64_t         ready_at;
+	bool             ready_due;
+	bool             ready_high;
+
+	bool             armed[CAPTURE_EDGE_COUNT];
+	uint32_t         edge_tick[CAPTURE_EDGE_COUNT];
+
+	CAPTURE_CALLBACK      callback;
+	uintptr_t             context;
+	CAPTURE_EDGE_CALLBACK edge_callback;
+	uintptr_t             edge_context;
+
+	uint8_t *        dest;
+	uint32_t         size;
+	uint32_t         offset;
+	uint32_t         length;        // 0 runs until triggered
+	uint32_t         done;
+	uint16_t *       logic;
+	uint64_t         start;         // sample clock of this transfer
+	uint64_t         fed;
+	uint64_t         start_tick;
+	bool             busy;
+	bool             ready_watch;   // the ready line falling ends it
+	capture_stats_t  stats;
+
+	uint32_t         ring_pre;
+	bool             ring_active;
+	bool             ring_wait;
+
+	uint8_t *        seg_dest;
+	uint64_t *       seg_stamps;
+	uint32_t         seg_length;
+	uint32_t         seg_count;
+	uint32_t         seg_done;
+	bool             seg_active;
+} capture_sim_t;
+
+static capture_sim_t sim;
+
+static void sim_transfer_start (void);
+static void sim_feed           (uint64_t until);
+static void sim_finish         (bool error);
+static void sim_edge_fire      (capture_edge_t edge);
+static void sim_ring_trigger   (void);
+static void sim_seg_arm        (void);
+static void sim_seg_edge       (capture_edge_t edge, uint32_t tick);
+
+
+void
+capture_sim_configure (const capture_sim_config_t * config)
+{
+	sim.config = *config;
+}
+
+void
+capture_sim_advance (uint32_t ticks)
+{
+	uint64_t target = sim.now + ticks;
+
+	for (;;)
+	{
+		uint64_t next = target;
+
+		if (sim.config.trigger_count && sim.next_trigger < next)
+		{
+			next = sim.next_trigger;
+		}
+		if (sim.ready_due && sim.ready_at < next)
+		{
+			next = sim.ready_at;
+		}
+
+		sim_feed(next);
+		sim.now = next;
+
+		if (sim.config.trigger_count && sim.next_trigger <= sim.now)
+		{
+			// Only a line that was low makes an edge
+			bool edge = sim.now >= sim.trigger_high;
+			uint32_t interval;
+
+			sim.trigger_high = sim.now + sim.config.trigger_width;
+			sim.pattern_pos = (sim.pattern_pos + 1U) % sim.config.trigger_count;
+			interval = sim.config.trigger_pattern[sim.pattern_pos];
+			sim.next_trigger += interval ? interval : 1U;
+
+			if (edge && sim.armed[CAPTURE_EDGE_TRIGGER])
+			{
+				sim_edge_fire(CAPTURE_EDGE_TRIGGER);
+			}
+		}
+		else if (sim.ready_due && sim.ready_at <= sim.now)
+		{
+			sim.ready_due = false;
+			sim.ready_high = true;
+
+			if (sim.armed[CAPTURE_EDGE_READY])
+			{
+				sim_edge_fire(CAPTURE_EDGE_READY);
+			}
+		}
+		else if (sim.now >= target)
+		{
+			break;
+		}
+	}
+}
+
+uint64_t
+capture_sim_now (void)
+{
+	return sim.now;
+}
+
+uint64_t
+capture_sim_samples (void)
+{
+	return sim.samples;
+}
+
+uint32_t
+CORETIMER_CounterGet (void)
+{
+	return (uint32_t) sim.now;
+}
+
+uint32_t
+CORETIMER_FrequencyGet (void)
+{
+	return CAPTURE_SIM_TICK_RATE;
+}
+
+
+void
+capture_init (void)
+{
+	capture_sim_config_t config = sim.config;
+
+	memset(&sim, 0, sizeof(sim));
+	sim.config = config;
+
+	if (sim.config.trigger_count)
+	{
+		sim.next_trigger = sim.config.trigger_pattern[0];
+	}
+}
+
+void
+capture_callback_register (CAPTURE_CALLBACK callback, uintptr_t context)
+{
+	sim.callback = callback;
+	sim.context = context;
+}
+
+void
+capture_ready (bool ready)
+{
+	if (!ready)
+	{
+		sim.ready_due = false;
+		sim.ready_high = false;
+	}
+	else if (!sim.ready_high && !sim.ready_due)
+	{
+		sim.ready_due = true;
+		sim.ready_at = sim.now + sim.config.ready_latency;
+	}
+}
+
+bool
+capture_start (uint8_t * dest, uint32_t length)
+{
+	return capture_mixed_start(dest, NULL, length);
+}
+
+bool
+capture_mixed_start (uint8_t * dest, uint16_t * logic, uint32_t length)
+{
+	if (sim.busy || 0 == length)
+	{
+		return false;
+	}
+
+	sim.dest = dest;
+	sim.size = length;
+	sim.offset = 0;
+	sim.length = length;
+	sim.logic = logic;
+	sim.ready_watch = true;
+	sim_transfer_start();
+
+	if (!sim.ready_high)
+	{
+		// The FPGA has nothing to give
+		sim_finish(false);
+	}
+	return true;
+}
+
+bool
+capture_ring_start (uint8_t * dest, uint32_t length, uint32_t pre)
+{
+	if (capture_busy() || 0 == length || pre >= length)
+	{
+		return false;
+	}
+
+	sim.dest = dest;
+	sim.size = length;
+	sim.offset = 0;
+	sim.length = 0;
+	sim.logic = NULL;
+	sim.ready_watch = false;
+	sim.ring_pre = pre;
+	sim.ring_wait = 0 != pre;
+	sim.ring_active = true;
+	sim_transfer_start();
+
+	if (!sim.ring_wait && capture_edge_arm(CAPTURE_EDGE_TRIGGER))
+	{
+		sim_ring_trigger();
+	}
+	return true;
+}
+
+uint32_t
+capture_ring_stop (void)
+{
+	return (sim.offset + sim.done) % sim.size;
+}
+
+void
+capture_abort (void)
+{
+	if (sim.seg_active)
+	{
+		sim.seg_active = false;
+		capture_edge_disarm(CAPTURE_EDGE_TRIGGER);
+		capture_edge_disarm(CAPTURE_EDGE_READY);
+		capture_ready(false);
+	}
+
+	if (sim.ring_active)
+	{
+		sim.ring_active = false;
+		capture_edge_disarm(CAPTURE_EDGE_TRIGGER);
+	}
+
+	if (!sim.busy)
+	{
+		return;
+	}
+
+	sim.stats.bytes = sim.done;
+	sim.busy = false;
+	sim.ready_watch = false;
+}
+
+bool
+capture_busy (void)
+{
+	return sim.busy || sim.seg_active || sim.ring_active;
+}
+
+void
+capture_stats_get (capture_stats_t * stats)
+{
+	*stats = sim.stats;
+}
+
+bool
+capture_segments_start (uint8_t * dest, uint32_t length, uint32_t count,
+	uint64_t * stamps)
+{
+	if (capture_busy() || 0 == length || 0 == count)
+	{
+		return false;
+	}
+
+	sim.seg_dest = dest;
+	sim.seg_stamps = stamps;
+	sim.seg_length = length;
+	sim.seg_count = count;
+	sim.seg_done = 0;
+	sim.seg_active = true;
+
+	sim_seg_arm();
+	return true;
+}
+
+uint32_t
+capture_segments_done (void)
+{
+	return sim.seg_done;
+}
+
+void
+capture_edge_callback_register (CAPTURE_EDGE_CALLBACK callback,
+	uintptr_t context)
+{
+	sim.edge_callback = callback;
+	sim.edge_context = context;
+}
+
+bool
+capture_edge_arm (capture_edge_t edge)
+{
+	// Same contract as on the board: a line that is already high counts
+	// as the edge and is not armed
+	bool level = (CAPTURE_EDGE_TRIGGER == edge)
+		? sim.now < sim.trigger_high : sim.ready_high;
+
+	sim.armed[edge] = !level;
+	if (level)
+	{
+		sim.edge_tick[edge] = (uint32_t) sim.now;
+	}
+	return level;
+}
+
+void
+capture_edge_disarm (capture_edge_t edge)
+{
+	sim.armed[edge] = false;
+}
+
+uint32_t
+capture_edge_tick (capture_edge_t edge)
+{
+	return sim.edge_tick[edge];
+}
+
+
+static void
+sim_transfer_start (void)
+{
+	sim.done = 0;
+	sim.fed = 0;
+	sim.start = sim.now;
+	sim.start_tick = sim.now;
+	memset(&(sim.stats), 0, sizeof(sim.stats));
+	sim.stats.start_tick = (uint32_t) sim.now;
+	sim.stats.cpu_ticks = sim.config.isr_ticks;
+	sim.busy = true;
+}
+
+static void
+sim_feed (uint64_t until)
+{
+	// Deliver the samples due by until. A completion may start the next
+	// transfer from its callback, which then carries on from there.
+	while (sim.busy && sim.config.sample_rate)
+	{
+		uint64_t at = sim.start + (sim.fed * CAPTURE_SIM_TICK_RATE)
+			/ sim.config.sample_rate;
+		uint32_t pos = (sim.offset + sim.done) % sim.size;
+		uint32_t n = (uint32_t) sim.samples;
+
+		if (at > until)
+		{
+			break;
+		}
+		sim.now = at;
+
+		if (sim.ready_watch && sim.config.ready_length
+			&& sim.fed >= sim.config.ready_length)
+		{
+			sim.ready_high = false;
+			sim_finish(false);
+			continue;
+		}
+
+		sim.dest[pos] = (uint8_t) n;
+		if (NULL != sim.logic)
+		{
+			sim.logic[pos] = (uint16_t) (((n >> 0) & 1U) << CAPTURE_EXIO0_BIT
+				| ((n >> 1) & 1U) << CAPTURE_EXIO1_BIT
+				| ((n >> 2) & 1U) << CAPTURE_EXIO2_BIT
+				| ((n >> 3) & 1U) << CAPTURE_EXIO3_BIT);
+			sim.logic[sim.size + pos] = (uint16_t) (
+				((n >> 4) & 1U) << CAPTURE_FPIO3_BIT
+				| ((n >> 5) & 1U) << CAPTURE_FPIO4_BIT);
+		}
+		sim.samples++;
+		sim.fed++;
+		sim.done++;
+
+		// One DMA block interrupt per CAPTURE_BLOCK_MAX samples
+		if (0 == sim.fed % CAPTURE_BLOCK_MAX)
+		{
+			sim.stats.cpu_ticks += sim.config.isr_ticks;
+		}
+
+		if (0 == sim.length)
+		{
+			bool waiting = sim.ring_wait;
+
+			if (sim.done >= sim.size)
+			{
+				sim.done -= sim.size;
+				sim.ring_wait = false;
+			}
+			if (sim.ring_wait && sim.done >= sim.ring_pre)
+			{
+				sim.ring_wait = false;
+			}
+			if (waiting && !sim.ring_wait
+				&& capture_edge_arm(CAPTURE_EDGE_TRIGGER))
+			{
+				sim_ring_trigger();
+			}
+		}
+		else if (sim.done >= sim.length)
+		{
+			sim_finish(false);
+		}
+	}
+}
+
+static void
+sim_finish (bool error)
+{
+	sim.stats.bytes = sim.done;
+	sim.stats.error = error;
+	sim.stats.ticks = (uint32_t) (sim.now - sim.start_tick);
+	sim.stats.cpu_ticks += sim.config.isr_ticks;
+	sim.busy = false;
+	sim.ready_watch = false;
+
+	if (sim.seg_active)
+	{
+		capture_ready(false);
+		sim.seg_done++;
+		if (error || sim.seg_done >= sim.seg_count)
+		{
+			sim.seg_active = false;
+		}
+		else
+		{
+			sim_seg_arm();
+		}
+	}
+
+	if (NULL != sim.callback)
+	{
+		sim.callback(sim.context);
+	}
+}
+
+static void
+sim_edge_fire (capture_edge_t edge)
+{
+	uint32_t tick = (uint32_t) sim.now;
+
+	sim.edge_tick[edge] = tick;
+	sim.armed[edge] = false;
+
+	if (sim.seg_active)
+	{
+		sim_seg_edge(edge, tick);
+	}
+	else if (sim.ring_active)
+	{
+		if (CAPTURE_EDGE_TRIGGER == edge && !sim.ring_wait)
+		{
+			sim_ring_trigger();
+		}
+	}
+	else if (NULL != sim.edge_callback)
+	{
+		sim.edge_callback(edge, sim.edge_context);
+	}
+}
+
+static void
+sim_ring_trigger (void)
+{
+	sim.offset = (sim.offset + sim.done) % sim.size;
+	sim.done = 0;
+	sim.length = sim.size - sim.ring_pre;
+	sim.ring_active = false;
+	sim.start_tick = sim.now;
+}
+
+static void
+sim_seg_arm (void)
+{
+	if (capture_edge_arm(CAPTURE_EDGE_TRIGGER))
+	{
+		sim_seg_edge(CAPTURE_EDGE_TRIGGER,
+			sim.edge_tick[CAPTURE_EDGE_TRIGGER]);
+	}
+}
+
+static void
+sim_seg_edge (capture_edge_t edge, uint32_t tick)
+{
+	if (CAPTURE_EDGE_TRIGGER == edge)
+	{
+		bool ready;
+
+		sim.seg_stamps[sim.seg_done] = tick;
+		ready = capture_edge_arm(CAPTURE_EDGE_READY);
+		capture_ready(true);
+		if (ready)
+		{
+			sim_seg_edge(CAPTURE_EDGE_READY,
+				sim.edge_tick[CAPTURE_EDGE_READY]);
+		}
+	}
+	else
+	{
+		capture_start(sim.seg_dest + sim.seg_done * sim.seg_length,
+			sim.seg_length);
+	}
+}
@@ -0,0 +1,65 @@
+/*
+ * Simulated FPGA Front End
+ *
+ * @Company
+ *   Probe-Scope Team
+ *
+ * @File Name
+ *   capture_sim.h
+ *
+ * @Summary
+ *   Host model of the FPGA behind the capture.h interface
+*/
+
+#ifndef CAPTURE_SIM_H
+#define	CAPTURE_SIM_H
+
+
+#include "capture.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+// The model's clock stands in for the 100 MHz core timer
+#define CAPTURE_SIM_TICK_RATE 100000000U
+
+
+#ifdef	__cplusplus
+extern "C"
+{
+#endif
+
+
+typedef struct
+{
+	uint32_t         sample_rate;     // samples per second over the PMP
+	const uint32_t * trigger_pattern; // ticks between trigger edges, repeats
+	uint32_t         trigger_count;   // entries in trigger_pattern, 0 = none
+	uint32_t         trigger_width;   // ticks the trigger line stays high
+	uint32_t         ready_latency;   // ticks from PIC ready to buffer ready
+	uint32_t         ready_length;    // samples before buffer ready falls,
+	                                  // 0 = as many as are asked for
+	uint32_t         isr_ticks;       // CPU ticks charged per modelled ISR
+} capture_sim_config_t;
+
+
+// Call before capture_init(), the config is copied
+void     capture_sim_configure (const capture_sim_config_t * config);
+
+// Run the model for ticks of simulated time. Edges, completions and their
+// callbacks happen in here, in time order, as the ISRs would.
+void     capture_sim_advance (uint32_t ticks);
+uint64_t capture_sim_now     (void);
+uint64_t capture_sim_samples (void);
+
+// Host builds have no plib, these stand in for it
+uint32_t CORETIMER_CounterGet   (void);
+uint32_t CORETIMER_FrequencyGet (void);
+
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* CAPTURE_SIM_H */
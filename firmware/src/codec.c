@@ -0,0 +1,201 @@
+/*
+ * Sample Compression
+ *
+ * @Company
+ *   Probe-Scope Team
+ *
+ * @File Name
+ *   codec.c
+ *
+ * @Summary
+ *   Lossless zig-zag delta / run length coding of sample records
+*/
+
+#include "codec.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+#define CODEC_RUN     0x00U
+#define CODEC_PAIR    0x40U
+#define CODEC_SINGLE  0x80U
+#define CODEC_LITERAL 0xC0U
+#define CODEC_MASK    0xC0U
+
+#define CODEC_RUN_MAX     64U
+#define CODEC_LITERAL_MAX 64U
+
+// Worst case output of one sample: a pending token, a literal token and
+// the sample itself
+#define CODEC_STEP_MAX 3U
+
+
+void
+codec_init (codec_state_t * state)
+{
+	state->prev = 0;
+	state->pair = 0;
+	state->has_pair = false;
+	state->run = 0;
+	state->literal = NULL;
+}
+
+uint32_t
+codec_encode (codec_state_t * state, const uint8_t * in, uint32_t length,
+	uint32_t * used, uint8_t * out, uint32_t capacity)
+{
+	uint8_t * o = out;
+	uint32_t i;
+
+	for (i = 0; i < length && (uint32_t) (o - out) + CODEC_STEP_MAX
+		<= capacity; i++)
+	{
+		int8_t d = (int8_t) (in[i] - state->prev);
+		uint8_t z = (uint8_t) (((uint8_t) d << 1) ^ (uint8_t) (d >> 7));
+
+		state->prev = in[i];
+
+		if (state->has_pair)
+		{
+			if (z < 8U)
+			{
+				*o++ = (uint8_t) (CODEC_PAIR | (state->pair << 3) | z);
+				state->has_pair = false;
+				continue;
+			}
+			*o++ = (uint8_t) (CODEC_SINGLE | state->pair);
+			state->has_pair = false;
+		}
+		else if (0U == z)
+		{
+			state->literal = NULL;
+			if (++state->run == CODEC_RUN_MAX)
+			{
+				*o++ = (uint8_t) (CODEC_RUN | (state->run - 1U));
+				state->run = 0;
+			}
+			continue;
+		}
+
+		if (state->run)
+		{
+			*o++ = (uint8_t) (CODEC_RUN | (state->run - 1U));
+			state->run = 0;
+		}
+
+		if (z < 64U)
+		{
+			state->literal = NULL;
+			if (z < 8U)
+			{
+				state->pair = z;
+				state->has_pair = true;
+			}
+			else
+			{
+				*o++ = (uint8_t) (CODEC_SINGLE | z);
+			}
+			continue;
+		}
+
+		// Too far from the last sample, send it as it is
+		if (NULL == state->literal
+			|| (*state->literal & ~CODEC_MASK) == CODEC_LITERAL_MAX - 1U)
+		{
+			state->literal = o;
+			*o++ = CODEC_LITERAL;
+		}
+		else
+		{
+			(*state->literal)++;
+		}
+		*o++ = in[i];
+	}
+
+	// A literal token must not grow once its output has gone
+	state->literal = NULL;
+	*used = i;
+	return (uint32_t) (o - out);
+}
+
+uint32_t
+codec_flush (codec_state_t * state, uint8_t * out)
+{
+	// Only one of a run and a pair can be pending
+	uint32_t n = 0;
+
+	if (state->run)
+	{
+		out[n++] = (uint8_t) (CODEC_RUN | (state->run - 1U));
+		state->run = 0;
+	}
+	else if (state->has_pair)
+	{
+		out[n++] = (uint8_t) (CODEC_SINGLE | state->pair);
+		state->has_pair = false;
+	}
+	state->literal = NULL;
+	return n;
+}
+
+uint32_t
+codec_decode (const uint8_t * in, uint32_t length, uint8_t * out,
+	uint32_t capacity)
+{
+	const uint8_t * end = in + length;
+	uint8_t prev = 0;
+	uint32_t n = 0;
+	uint32_t count;
+	uint8_t z[2];
+	uint32_t k;
+
+	while (in < end)
+	{
+		uint8_t token = *in++;
+
+		switch (token & CODEC_MASK)
+		{
+			case CODEC_RUN:
+				for (count = (token & 0x3FU) + 1U; count && n < capacity;
+					count--)
+				{
+					out[n++] = prev;
+				}
+				break;
+
+			case CODEC_PAIR:
+			case CODEC_SINGLE:
+				k = 0;
+				if (CODEC_PAIR == (token & CODEC_MASK))
+				{
+					z[k++] = (token >> 3) & 0x07U;
+					z[k++] = token & 0x07U;
+				}
+				else
+				{
+					z[k++] = token & 0x3FU;
+				}
+				for (count = 0; count < k && n < capacity; count++)
+				{
+					// Undo the zig-zag fold
+					prev = (uint8_t) (prev + (uint8_t) ((z[count] >> 1)
+						^ (uint8_t) -(z[count] & 1U)));
+					out[n++] = prev;
+				}
+				break;
+
+			default:
+				for (count = (token & 0x3FU) + 1U; count && in < end
+					&& n < capacity; count--)
+				{
+					prev = *in++;
+					out[n++] = prev;
+				}
+				break;
+		}
+	}
+
+	return n;
+}
@@ -0,0 +1,78 @@
+/*
+ * Sample Compression
+ *
+ * @Company
+ *   Probe-Scope Team
+ *
+ * @File Name
+ *   codec.h
+ *
+ * @Summary
+ *   Lossless zig-zag delta / run length coding of sample records
+*/
+
+#ifndef CODEC_H
+#define	CODEC_H
+
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+// Codec ids as sent to the host, see app_regs_t compression
+#define CODEC_NONE  0U
+#define CODEC_DELTA 1U
+
+// Most bytes codec_flush() writes
+#define CODEC_FLUSH_MAX 1U
+
+
+#ifdef	__cplusplus
+extern "C"
+{
+#endif
+
+
+// Each sample is coded as the zig-zag folded difference z to the one
+// before it (the first to 0), in tokens of one byte:
+//
+//   00rrrrrr  r + 1 samples with z = 0
+//   01aaabbb  two samples, z = a then z = b
+//   10zzzzzz  one sample with z < 64
+//   11nnnnnn  n + 1 samples follow as they are
+//
+// Smooth waveforms take about half a byte per sample, flat lines 1/64,
+// noise a little over one.
+typedef struct
+{
+	uint8_t   prev;      // last sample coded
+	uint8_t   pair;      // z waiting for a second one to share a token
+	bool      has_pair;
+	uint8_t   run;       // zero deltas not written yet
+	uint8_t * literal;   // open 11nnnnnn token in the current output
+} codec_state_t;
+
+
+void     codec_init   (codec_state_t * state);
+
+// Code samples from in until they run out or out has no room for more.
+// Returns the bytes written, *used gets the samples taken. Nothing in out
+// points back into earlier calls, so each output may go out on its own.
+uint32_t codec_encode (codec_state_t * state, const uint8_t * in,
+                       uint32_t length, uint32_t * used, uint8_t * out,
+                       uint32_t capacity);
+
+// Write what the state still holds, at the end of the record
+uint32_t codec_flush  (codec_state_t * state, uint8_t * out);
+
+// Reference decoder for hosts: a whole coded record to at most capacity
+// samples. Returns the samples written.
+uint32_t codec_decode (const uint8_t * in, uint32_t length, uint8_t * out,
+                       uint32_t capacity);
+
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* CODEC_H */
@@ -1,131 +1,157 @@
-/*
- * Communications Interface
- * 
- * @Company
- *   Probe-Scope Team
- * 
- * @File Name
- *   comms.h
- * 
- * @Summary
- *   Operates the USB CDC library
-*/
-
-#ifndef COMMS_H
-#define	COMMS_H
-
-
-#include "definitions.h"
-
-
-#define CDC_READ_BUFFER_SIZE 0x200
-
-
-#ifdef	__cplusplus
-extern "C"
-{
-#endif
-
-
-typedef enum
-{
-    // State machine's initial state.
-    CC_STATE_INIT=0,
-	
-    // Wait for device configuration
-    CC_STATE_WAIT_FOR_CONFIGURATION,
-	
-	// Main transaction processor
-	CC_STATE_TRANSACT,
-	
-	/*
-    // Wait for a character receive
-    CC_STATE_SCHEDULE_READ,
-	
-    // A character is received from host
-    CC_STATE_WAIT_FOR_READ_COMPLETE,
-	
-    // Wait for the TX to get completed
-    CC_STATE_SCHEDULE_WRITE,
-	
-    // Wait for the write to complete
-    CC_STATE_WAIT_FOR_WRITE_COMPLETE,
-	*/
-	
-    // Error state
-    CC_STATE_ERROR
-} cdc_comms_states_t;
-
-typedef enum
-{
-	RXTX_IDLE,
-	RXTX_READY,
-	RXTX_BUSY
-} cdc_rxtx_state_t;
-
-typedef struct
-{
-	SYS_MODULE_INDEX deviceIndex;
-	
-    /* Device layer handle returned by device layer open function */
-    USB_DEVICE_HANDLE deviceHandle;
-
-    /* Application's current state*/
-    cdc_comms_states_t state;
-
-    /* Set Line Coding Data */
-    USB_CDC_LINE_CODING setLineCodingData;
-
-    /* Device configured state */
-    bool isConfigured;
-
-    /* Get Line Coding Data */
-    USB_CDC_LINE_CODING getLineCodingData;
-
-    /* Control Line State */
-    USB_CDC_CONTROL_LINE_STATE controlLineStateData;
-
-    /* Read transfer handle */
-    USB_DEVICE_CDC_TRANSFER_HANDLE readTransferHandle;
-
-    /* Write transfer handle */
-    USB_DEVICE_CDC_TRANSFER_HANDLE writeTransferHandle;
-
-    cdc_rxtx_state_t transmitState;
-	cdc_rxtx_state_t receiveState;
-	
-	uint32_t receiveBytes;
-	uint32_t receiveBytesTotal;
-
-    /* Flag determines SOF event occurrence */
-    bool sofEventHasOccurred;
-
-    /* Break data */
-    uint16_t breakData;
-
-    /* Application CDC read buffer */
-    uint8_t * cdcReadBuffer;
-	uint32_t  cdcReadBufferSize;
-	
-	bool rx_auto;
-	bool rx_auto_fail;
-	uint8_t rx_auto_terminator;
-	uint32_t rx_target_bytes;
-	uint8_t * rx_out;
-} cdc_comms_t;
-
-void comms_init (cdc_comms_t * cdc_comms, SYS_MODULE_INDEX deviceIndex);
-void comms_task (cdc_comms_t * cdc_comms);
-
-bool comms_transmit (cdc_comms_t * cdc_comms, uint8_t * buffer, uint32_t bytes);
-bool comms_receive (cdc_comms_t * cdc_comms, uint8_t * buffer, uint32_t bytes);
-bool comms_receive_auto (cdc_comms_t * cdc_comms, uint8_t * buffer,
-						 uint32_t bytes, uint8_t terminator);
-
-
-#ifdef	__cplusplus
-}
-#endif
-
-#endif	/* COMMS_H */
-
+/*
+ * Communications Interface
+ * 
+ * @Company
+ *   Probe-Scope Team
+ * 
+ * @File Name
+ *   comms.h
+ * 
+ * @Summary
+ *   Operates the USB CDC library
+*/
+
+#ifndef COMMS_H
+#define	COMMS_H
+
+
+#include "definitions.h"
+
+
+#define CDC_READ_BUFFER_SIZE 0x200
+
+// Writes that may be queued with the CDC driver at once
+#define COMMS_TX_DEPTH 2U
+
+
+#ifdef	__cplusplus
+extern "C"
+{
+#endif
+
+
+typedef enum
+{
+    // State machine's initial state.
+    CC_STATE_INIT=0,
+	
+    // Wait for device configuration
+    CC_STATE_WAIT_FOR_CONFIGURATION,
+	
+	// Main transaction processor
+	CC_STATE_TRANSACT,
+	
+	/*
+    // Wait for a character receive
+    CC_STATE_SCHEDULE_READ,
+	
+    // A character is received from host
+    CC_STATE_WAIT_FOR_READ_COMPLETE,
+	
+    // Wait for the TX to get completed
+    CC_STATE_SCHEDULE_WRITE,
+	
+    // Wait for the write to complete
+    CC_STATE_WAIT_FOR_WRITE_COMPLETE,
+	*/
+	
+    // Error state
+    CC_STATE_ERROR
+} cdc_comms_states_t;
+
+typedef enum
+{
+	RXTX_IDLE,
+	RXTX_READY,
+	RXTX_BUSY
+} cdc_rxtx_state_t;
+
+// Called when a CDC read or write completes, usually from the USB ISR
+typedef void (*COMMS_EVENT_CALLBACK) (uintptr_t context);
+
+typedef struct
+{
+	SYS_MODULE_INDEX deviceIndex;
+	
+    /* Device layer handle returned by device layer open function */
+    USB_DEVICE_HANDLE deviceHandle;
+
+    /* Application's current state*/
+    cdc_comms_states_t state;
+
+    /* Set Line Coding Data */
+    USB_CDC_LINE_CODING setLineCodingData;
+
+    /* Device configured state */
+    bool isConfigured;
+
+    /* Get Line Coding Data */
+    USB_CDC_LINE_CODING getLineCodingData;
+
+    /* Control Line State */
+    USB_CDC_CONTROL_LINE_STATE controlLineStateData;
+
+    /* Read transfer handle */
+    USB_DEVICE_CDC_TRANSFER_HANDLE readTransferHandle;
+
+    /* Write transfer handle */
+    USB_DEVICE_CDC_TRANSFER_HANDLE writeTransferHandle;
+
+    cdc_rxtx_state_t transmitState;
+	cdc_rxtx_state_t receiveState;
+	
+	// Writes queued and finished. Only the task counts up transmitSubmitted
+	// and only the write complete event counts up transmitCompleted, so
+	// neither needs a lock.
+	volatile uint32_t transmitSubmitted;
+	volatile uint32_t transmitCompleted;
+	
+	uint32_t receiveBytes;
+	uint32_t receiveBytesTotal;
+
+    /* Flag determines SOF event occurrence */
+    bool sofEventHasOccurred;
+
+    /* Break data */
+    uint16_t breakData;
+
+    /* Application CDC read buffer */
+    uint8_t * cdcReadBuffer;
+	uint32_t  cdcReadBufferSize;
+	
+	bool rx_auto;
+	bool rx_auto_fail;
+	uint8_t rx_auto_terminator;
+	uint32_t rx_target_bytes;
+	uint8_t * rx_out;
+	bool rx_escaped;             // last byte was an unescaped IF_ESCAPE
+	const uint8_t * rx_carry;    // read past the terminator, in cdcReadBuffer
+	uint32_t rx_carry_bytes;
+	
+	COMMS_EVENT_CALLBACK event_callback;
+	uintptr_t event_context;
+} cdc_comms_t;
+
+void comms_init (cdc_comms_t * cdc_comms, SYS_MODULE_INDEX deviceIndex);
+void comms_task (cdc_comms_t * cdc_comms);
+void comms_event_callback_register (cdc_comms_t * cdc_comms,
+	COMMS_EVENT_CALLBACK callback, uintptr_t context);
+
+// Queue a write behind up to COMMS_TX_DEPTH - 1 others. With more set the
+// host sees no end of transfer, bytes must be a multiple of the packet size.
+bool comms_transmit (cdc_comms_t * cdc_comms, uint8_t * buffer, uint32_t bytes,
+	bool more);
+
+// Writes queued that have not finished yet
+uint32_t comms_transmit_pending (cdc_comms_t * cdc_comms);
+bool comms_receive (cdc_comms_t * cdc_comms, uint8_t * buffer, uint32_t bytes);
+bool comms_receive_auto (cdc_comms_t * cdc_comms, uint8_t * buffer,
+						 uint32_t bytes, uint8_t terminator);
+
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* COMMS_H */
+
@@ -1,140 +1,140 @@
-/*******************************************************************************
-  MPLAB Harmony Exceptions Source File
-
-  File Name:
-    exceptions.c
-
-  Summary:
-    This file contains a function which overrides the default _weak_ exception
-    handler provided by the XC32 compiler.
-
-  Description:
-    This file redefines the default _weak_  exception handler with a more debug
-    friendly one. If an unexpected exception occurs the code will stop in a
-    while(1) loop.  The debugger can be halted and two variables _excep_code and
-    _except_addr can be examined to determine the cause and address where the
-    exception occurred.
- *******************************************************************************/
-
-// DOM-IGNORE-BEGIN
-/*******************************************************************************
-* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
-*
-* Subject to your compliance with these terms, you may use Microchip software
-* and any derivatives exclusively with Microchip products. It is your
-* responsibility to comply with third party license terms applicable to your
-* use of third party software (including open source software) that may
-* accompany Microchip software.
-*
-* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
-* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
-* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
-* PARTICULAR PURPOSE.
-*
-* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
-* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
-* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
-* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
-* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
-* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
-* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
-*******************************************************************************/
-// DOM-IGNORE-END
-
-// *****************************************************************************
-// *****************************************************************************
-// Section: Included Files
-// *****************************************************************************
-// *****************************************************************************
-#include "configuration.h"
-#include "definitions.h"
-#include <stdio.h>
-
-
-// *****************************************************************************
-// *****************************************************************************
-// Section: Global Data Definitions
-// *****************************************************************************
-// *****************************************************************************
-
-/*******************************************************************************
-  Exception Reason Data
-
-  <editor-fold defaultstate="expanded" desc="Exception Reason Data">
-
-  Remarks:
-    These global static items are used instead of local variables in the
-    _general_exception_handler function because the stack may not be available
-    if an exception has occured.
-*/
-
-/* Code identifying the cause of the exception (CP0 Cause register). */
-static unsigned int _excep_code;
-
-/* Address of instruction that caused the exception. */
-static unsigned int _excep_addr;
-
-/* Pointer to the string describing the cause of the exception. */
-static char *_cause_str;
-
-/* Array identifying the cause (indexed by _exception_code). */
-static char *cause[] =
-{
-    "Interrupt",
-    "Undefined",
-    "Undefined",
-    "Undefined",
-    "Load/fetch address error",
-    "Store address error",
-    "Instruction bus error",
-    "Data bus error",
-    "Syscall",
-    "Breakpoint",
-    "Reserved instruction",
-    "Coprocessor unusable",
-    "Arithmetic overflow",
-    "Trap",
-    "Reserved",
-    "Reserved",
-    "Reserved",
-    "Reserved",
-    "Reserved"
-};
-
-// </editor-fold>
-
-/*******************************************************************************
-  Function:
-    void _general_exception_handler ( void )
-
-  Summary:
-    Overrides the XC32 _weak_ _generic_exception_handler.
-
-  Description:
-    This function overrides the XC32 default _weak_ _generic_exception_handler.
-
-  Remarks:
-    Refer to the XC32 User's Guide for additional information.
- */
-
-void _general_exception_handler ( void )
-{
-    /* Mask off Mask of the ExcCode Field from the Cause Register
-    Refer to the MIPs Software User's manual */
-    _excep_code = (_CP0_GET_CAUSE() & 0x0000007C) >> 2;
-    _excep_addr = _CP0_GET_EPC();
-
-    _cause_str  = cause[_excep_code];
-    printf("\n\rGeneral Exception %s (cause=%d, addr=%x).\n\r", _cause_str, _excep_code, _excep_addr);
-
-    while (1)
-    {
-        #if defined(__DEBUG) || defined(__DEBUG_D) && defined(__XC32)
-            __builtin_software_breakpoint();
-        #endif
-    }
-}
-
-/*******************************************************************************
- End of File
-*/
+/*******************************************************************************
+  MPLAB Harmony Exceptions Source File
+
+  File Name:
+    exceptions.c
+
+  Summary:
+    This file contains a function which overrides the default _weak_ exception
+    handler provided by the XC32 compiler.
+
+  Description:
+    This file redefines the default _weak_  exception handler with a more debug
+    friendly one. If an unexpected exception occurs the code will stop in a
+    while(1) loop.  The debugger can be halted and two variables _excep_code and
+    _except_addr can be examined to determine the cause and address where the
+    exception occurred.
+ *******************************************************************************/
+
+// DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include "configuration.h"
+#include "definitions.h"
+#include <stdio.h>
+
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/*******************************************************************************
+  Exception Reason Data
+
+  <editor-fold defaultstate="expanded" desc="Exception Reason Data">
+
+  Remarks:
+    These global static items are used instead of local variables in the
+    _general_exception_handler function because the stack may not be available
+    if an exception has occured.
+*/
+
+/* Code identifying the cause of the exception (CP0 Cause register). */
+static unsigned int _excep_code;
+
+/* Address of instruction that caused the exception. */
+static unsigned int _excep_addr;
+
+/* Pointer to the string describing the cause of the exception. */
+static char *_cause_str;
+
+/* Array identifying the cause (indexed by _exception_code). */
+static char *cause[] =
+{
+    "Interrupt",
+    "Undefined",
+    "Undefined",
+    "Undefined",
+    "Load/fetch address error",
+    "Store address error",
+    "Instruction bus error",
+    "Data bus error",
+    "Syscall",
+    "Breakpoint",
+    "Reserved instruction",
+    "Coprocessor unusable",
+    "Arithmetic overflow",
+    "Trap",
+    "Reserved",
+    "Reserved",
+    "Reserved",
+    "Reserved",
+    "Reserved"
+};
+
+// </editor-fold>
+
+/*******************************************************************************
+  Function:
+    void _general_exception_handler ( void )
+
+  Summary:
+    Overrides the XC32 _weak_ _generic_exception_handler.
+
+  Description:
+    This function overrides the XC32 default _weak_ _generic_exception_handler.
+
+  Remarks:
+    Refer to the XC32 User's Guide for additional information.
+ */
+
+void _general_exception_handler ( void )
+{
+    /* Mask off Mask of the ExcCode Field from the Cause Register
+    Refer to the MIPs Software User's manual */
+    _excep_code = (_CP0_GET_CAUSE() & 0x0000007C) >> 2;
+    _excep_addr = _CP0_GET_EPC();
+
+    _cause_str  = cause[_excep_code];
+    printf("\n\rGeneral Exception %s (cause=%d, addr=%x).\n\r", _cause_str, _excep_code, _excep_addr);
+
+    while (1)
+    {
+        #if defined(__DEBUG) || defined(__DEBUG_D) && defined(__XC32)
+            __builtin_software_breakpoint();
+        #endif
+    }
+}
+
+/*******************************************************************************
+ End of File
+*/
@@ -60,8 +60,11 @@
 
 
 void CORE_TIMER_InterruptHandler( void );
+void CHANGE_NOTICE_B_InterruptHandler( void );
+void CHANGE_NOTICE_F_InterruptHandler( void );
 void DRV_USBHS_InterruptHandler( void );
 void DRV_USBHS_DMAInterruptHandler( void );
+void DMA0_InterruptHandler( void );
 void SPI3_RX_InterruptHandler( void );
 void SPI3_TX_InterruptHandler( void );
 void SPI4_RX_InterruptHandler( void );
@@ -80,6 +83,16 @@ void CORE_TIMER_Handler (void)
     CORE_TIMER_InterruptHandler();
 }
 
+void CHANGE_NOTICE_B_Handler (void)
+{
+    CHANGE_NOTICE_B_InterruptHandler();
+}
+
+void CHANGE_NOTICE_F_Handler (void)
+{
+    CHANGE_NOTICE_F_InterruptHandler();
+}
+
 
 
 void USB_Handler (void)
@@ -92,6 +105,11 @@ void USB_DMA_Handler (void)
     DRV_USBHS_DMAInterruptHandler();
 }
 
+void DMA0_Handler (void)
+{
+    DMA0_InterruptHandler();
+}
+
 void SPI3_RX_Handler (void)
 {
     SPI3_RX_InterruptHandler();
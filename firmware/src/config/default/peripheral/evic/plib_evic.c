@@ -55,8 +55,11 @@ void EVIC_Initialize( void )
 
     /* Set up priority / subpriority of enabled interrupts */
     IPC0SET = 0x4 | 0x0;  /* CORE_TIMER:  Priority 1 / Subpriority 0 */
+    IPC29SET = 0x8000000 | 0x0;  /* CHANGE_NOTICE_B:  Priority 2 / Subpriority 0 */
+    IPC30SET = 0x8000000 | 0x0;  /* CHANGE_NOTICE_F:  Priority 2 / Subpriority 0 */
     IPC33SET = 0x4 | 0x0;  /* USB:  Priority 1 / Subpriority 0 */
     IPC33SET = 0x400 | 0x0;  /* USB_DMA:  Priority 1 / Subpriority 0 */
+    IPC33SET = 0x80000 | 0x0;  /* DMA0:  Priority 2 / Subpriority 0 */
     IPC38SET = 0x4000000 | 0x0;  /* SPI3_RX:  Priority 1 / Subpriority 0 */
     IPC39SET = 0x4 | 0x0;  /* SPI3_TX:  Priority 1 / Subpriority 0 */
     IPC41SET = 0x4 | 0x0;  /* SPI4_RX:  Priority 1 / Subpriority 0 */
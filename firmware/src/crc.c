@@ -0,0 +1,265 @@
+/*
+ * Frame Checksums
+ *
+ * @Company
+ *   Probe-Scope Team
+ *
+ * @File Name
+ *   crc.c
+ *
+ * @Summary
+ *   CRC-32 of outgoing data, on the DMA CRC engine where it can
+*/
+
+#include "crc.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+// The DMA controller has one CRC generator, fed by whichever channel it is
+// attached to. Channel 3 copies the data to a one byte sink with the
+// generator on: the CPU only starts a block and reads the result. Blocks
+// go CRC_DMA_BLOCK bytes at a time, the size registers are 16 bit.
+// Capture owns channels 0 to 2 and runs at a higher priority.
+//
+// How the generator orders the bits of its result is not written down
+// well, crc_init() finds out against CRC_CHECK and crc_result() undoes it.
+
+#define CRC_DMA_BLOCK 0x8000U
+
+typedef struct
+{
+	uint32_t        table[256];
+	bool            engine;     // passed the check in crc_init()
+	bool            reverse;    // its result comes bit reversed
+	bool            busy;
+	uint32_t        crc;        // the result without the engine
+	const uint8_t * next;       // data the engine has still to read
+	uint32_t        length;
+	const uint8_t * second;
+	uint32_t        second_length;
+} crc_data_t;
+
+static crc_data_t crc_data;
+
+
+uint32_t
+crc32 (uint32_t crc, const uint8_t * in, uint32_t length)
+{
+	crc = ~crc;
+	for (; length; in++, length--)
+	{
+		crc = crc_data.table[(crc ^ *in) & 0xFFU] ^ (crc >> 8);
+	}
+	return ~crc;
+}
+
+#if defined(__XC32)
+
+#include "definitions.h"
+
+// Out of the data cache, as frame data is
+static uint8_t __attribute__((coherent, aligned(16)))
+	crc_check_data[9] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+static uint8_t __attribute__((coherent)) crc_sink;
+
+static uint32_t
+crc_reverse (uint32_t x)
+{
+	x = ((x >> 1) & 0x55555555U) | ((x & 0x55555555U) << 1);
+	x = ((x >> 2) & 0x33333333U) | ((x & 0x33333333U) << 2);
+	x = ((x >> 4) & 0x0F0F0F0FU) | ((x & 0x0F0F0F0FU) << 4);
+	return __builtin_bswap32(x);
+}
+
+static void
+crc_dma_block (void)
+{
+	// The next block of the current span, forced to run at once
+	uint32_t n = (crc_data.length < CRC_DMA_BLOCK)
+		? crc_data.length : CRC_DMA_BLOCK;
+	
+	DCH3SSA = KVA_TO_PA(crc_data.next);
+	DCH3SSIZ = n;
+	DCH3CSIZ = n;
+	DCH3INTCLR = _DCH3INT_CHBCIF_MASK;
+	DCH3CONSET = _DCH3CON_CHEN_MASK;
+	DCH3ECONSET = _DCH3ECON_CFORCE_MASK;
+	
+	crc_data.next += n;
+	crc_data.length -= n;
+}
+
+static bool
+crc_dma_poll (void)
+{
+	// Start the block after a finished one, true when none is left
+	if (DCH3CON & _DCH3CON_CHEN_MASK)
+	{
+		return false;
+	}
+	
+	if (0 == crc_data.length && crc_data.second_length)
+	{
+		crc_data.next = crc_data.second;
+		crc_data.length = crc_data.second_length;
+		crc_data.second_length = 0;
+	}
+	
+	if (crc_data.length)
+	{
+		crc_dma_block();
+		return false;
+	}
+	return true;
+}
+
+static void
+crc_dma_stop (void)
+{
+	DCH3CONCLR = _DCH3CON_CHEN_MASK;
+}
+
+static uint32_t
+crc_dma_value (void)
+{
+	uint32_t crc = DCRCDATA;
+	
+	return ~(crc_data.reverse ? crc_reverse(crc) : crc);
+}
+
+static void
+crc_dma_init (void)
+{
+	// LFSR, 32 bit, least significant bit first, on channel 3
+	DMACONSET = _DMACON_ON_MASK;
+	DCH3CON = (0x0U << _DCH3CON_CHPRI_POSITION);
+	DCH3ECON = 0;
+	DCH3INT = 0;
+	DCH3DSA = KVA_TO_PA(&crc_sink);
+	DCH3DSIZ = 1;
+	
+	DCRCCON = (3U << _DCRCCON_CRCCH_POSITION)
+		| (31U << _DCRCCON_PLEN_POSITION)
+		| _DCRCCON_BITO_MASK | _DCRCCON_CRCEN_MASK;
+	DCRCXOR = CRC_POLY;
+}
+
+static bool
+crc_dma_check (void)
+{
+	uint32_t crc;
+	uint32_t t0 = CORETIMER_CounterGet();
+	
+	DCRCDATA = 0xFFFFFFFFU;
+	crc_data.next = crc_check_data;
+	crc_data.length = sizeof(crc_check_data);
+	crc_data.second_length = 0;
+	crc_dma_block();
+	
+	while (!crc_dma_poll())
+	{
+		if (CORETIMER_CounterGet() - t0 > CORETIMER_FrequencyGet() / 1000U)
+		{
+			crc_dma_stop();
+			return false;
+		}
+	}
+	
+	crc = DCRCDATA;
+	if (CRC_CHECK == ~crc)
+	{
+		crc_data.reverse = false;
+		return true;
+	}
+	if (CRC_CHECK == ~crc_reverse(crc))
+	{
+		crc_data.reverse = true;
+		return true;
+	}
+	return false;
+}
+
+#else
+
+// Host tools have no engine
+static void     crc_dma_init  (void) { }
+static bool     crc_dma_check (void) { return false; }
+static bool     crc_dma_poll  (void) { return true; }
+static void     crc_dma_stop  (void) { }
+static uint32_t crc_dma_value (void) { return 0; }
+
+#endif
+
+bool
+crc_init (void)
+{
+	uint32_t i, k;
+	
+	for (i = 0; i < 256U; i++)
+	{
+		uint32_t c = i;
+		
+		for (k = 0; k < 8U; k++)
+		{
+			c = (c & 1U) ? ((c >> 1) ^ 0xEDB88320U) : (c >> 1);
+		}
+		crc_data.table[i] = c;
+	}
+	
+	crc_data.busy = false;
+	crc_data.crc = 0;
+	crc_data.reverse = false;
+	
+	crc_dma_init();
+	crc_data.engine = crc_dma_check();
+	return crc_data.engine;
+}
+
+void
+crc_start (const uint8_t * first, uint32_t first_length,
+	const uint8_t * second, uint32_t second_length, bool dma_safe)
+{
+	if (crc_data.busy)
+	{
+		// the last result was never taken
+		crc_dma_stop();
+		crc_data.busy = false;
+	}
+	
+	if (!dma_safe || !crc_data.engine)
+	{
+		crc_data.crc = crc32(crc32(0, first, first_length), second,
+			second_length);
+		return;
+	}
+	
+#if defined(__XC32)
+	DCRCDATA = 0xFFFFFFFFU;
+#endif
+	crc_data.next = first;
+	crc_data.length = first_length;
+	crc_data.second = second;
+	crc_data.second_length = second_length;
+	crc_data.busy = true;
+	crc_dma_poll();
+}
+
+bool
+crc_result (uint32_t * crc)
+{
+	if (crc_data.busy)
+	{
+		if (!crc_dma_poll())
+		{
+			return false;
+		}
+		crc_data.crc = crc_dma_value();
+		crc_data.busy = false;
+	}
+	
+	*crc = crc_data.crc;
+	return true;
+}
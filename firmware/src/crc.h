@@ -0,0 +1,57 @@
+/*
+ * Frame Checksums
+ *
+ * @Company
+ *   Probe-Scope Team
+ *
+ * @File Name
+ *   crc.h
+ *
+ * @Summary
+ *   CRC-32 of outgoing data, on the DMA CRC engine where it can
+*/
+
+#ifndef CRC_H
+#define	CRC_H
+
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+// CRC-32 as zlib and Ethernet have it: polynomial 0x04C11DB7 reflected,
+// seed and final XOR 0xFFFFFFFF. CRC_CHECK is the CRC of "123456789".
+#define CRC_POLY  0x04C11DB7U
+#define CRC_CHECK 0xCBF43926U
+
+
+#ifdef	__cplusplus
+extern "C"
+{
+#endif
+
+
+// Build the table and try the engine against CRC_CHECK. False if it does
+// not give it, crc_start() then works in software.
+bool     crc_init   (void);
+
+// CRC-32 of length bytes at in, continuing crc (0 to start), in software.
+// Plain C, host tools check the trailers with this or zlib's crc32().
+uint32_t crc32      (uint32_t crc, const uint8_t * in, uint32_t length);
+
+// CRC-32 of first then second (second_length may be 0). With dma_safe the
+// engine reads them in the background, the data must stay put and be out
+// of the data cache until crc_result() is true. Otherwise it is done here.
+void     crc_start  (const uint8_t * first, uint32_t first_length,
+                     const uint8_t * second, uint32_t second_length,
+                     bool dma_safe);
+
+// The CRC of what crc_start() was given, once all of it is through
+bool     crc_result (uint32_t * crc);
+
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* CRC_H */
@@ -0,0 +1,354 @@
+/*
+ * Sample Processing
+ *
+ * @Company
+ *   Probe-Scope Team
+ *
+ * @File Name
+ *   dsp.c
+ *
+ * @Summary
+ *   Reductions over captured samples
+*/
+
+#include "dsp.h"
+
+#include <stdint.h>
+
+
+// The microAptiv core has the DSP ASE, which compares, selects and
+// multiplies four packed bytes at once. Builds without it (host tools) use plain C.
+
+// The project passes -mdspr2, a PIC32 build must not fall back quietly
+#if defined(__XC32) && !defined(__mips_dsp)
+#error "dsp.c wants the DSP ASE, build with -mdspr2"
+#endif
+
+#if defined(__mips_dsp)
+
+typedef signed char v4i8 __attribute__ ((vector_size(4)));
+typedef short v2i16 __attribute__ ((vector_size(4)));
+typedef long long a64;
+
+void
+dsp_minmax (const uint8_t * in, uint32_t length, uint8_t * min, uint8_t * max)
+{
+	uint8_t lo = *min;
+	uint8_t hi = *max;
+	uint32_t i;
+
+	// Single bytes up to a word boundary
+	for (; length && ((uintptr_t) in & 3U); in++, length--)
+	{
+		lo = (*in < lo) ? *in : lo;
+		hi = (*in > hi) ? *in : hi;
+	}
+
+	if (length >= 4U)
+	{
+		// Four lanes of running min and max, a word per step:
+		// CMPU.LT.QB sets a condition bit per lane, PICK.QB selects on it
+		const v4i8 * w = (const v4i8 *) in;
+		v4i8 vlo = w[0];
+		v4i8 vhi = w[0];
+		uint8_t lanes[8];
+
+		for (i = 1; i < length / 4U; i++)
+		{
+			__builtin_mips_cmpu_lt_qb(w[i], vlo);
+			vlo = __builtin_mips_pick_qb(w[i], vlo);
+			__builtin_mips_cmpu_lt_qb(vhi, w[i]);
+			vhi = __builtin_mips_pick_qb(w[i], vhi);
+		}
+
+		__builtin_memcpy(&lanes[0], &vlo, 4);
+		__builtin_memcpy(&lanes[4], &vhi, 4);
+		for (i = 0; i < 4U; i++)
+		{
+			lo = (lanes[i] < lo) ? lanes[i] : lo;
+			hi = (lanes[4 + i] > hi) ? lanes[4 + i] : hi;
+		}
+
+		in += length & ~3U;
+		length &= 3U;
+	}
+
+	for (; length; in++, length--)
+	{
+		lo = (*in < lo) ? *in : lo;
+		hi = (*in > hi) ? *in : hi;
+	}
+
+	*min = lo;
+	*max = hi;
+}
+
+uint32_t
+dsp_find_outside (const uint8_t * in, uint32_t length, uint8_t lo,
+	uint8_t hi)
+{
+	// CMPGU.LT.QB compares four lanes into a bit mask, lane 0 first. Below
+	// lo or hi below it, the lowest bit set is the first sample out.
+	uint32_t i = 0;
+	uint32_t k;
+
+	for (; i < length && ((uintptr_t) (in + i) & 3U); i++)
+	{
+		if (in[i] < lo || in[i] > hi)
+		{
+			return i;
+		}
+	}
+
+	{
+		const v4i8 * w = (const v4i8 *) (in + i);
+		v4i8 vlo = (v4i8) (0x01010101U * lo);
+		v4i8 vhi = (v4i8) (0x01010101U * hi);
+		uint32_t words = (length - i) / 4U;
+
+		for (k = 0; k < words; k++)
+		{
+			int out = __builtin_mips_cmpgu_lt_qb(w[k], vlo)
+				| __builtin_mips_cmpgu_lt_qb(vhi, w[k]);
+
+			if (out)
+			{
+				return i + 4U * k + (uint32_t) __builtin_ctz(out);
+			}
+		}
+		i += 4U * words;
+	}
+
+	for (; i < length; i++)
+	{
+		if (in[i] < lo || in[i] > hi)
+		{
+			return i;
+		}
+	}
+	return length;
+}
+
+uint32_t
+dsp_mask_find (const uint8_t * in, const uint8_t * mask, uint32_t length)
+{
+	// Four samples a step. PRECRQ.QB.PH takes the odd bytes of two words,
+	// the upper limits of four pairs, or the lower ones with the words
+	// shifted up a byte. The pairs need not be word aligned.
+	uint32_t i = 0;
+	uint32_t k;
+
+	for (; i < length && ((uintptr_t) (in + i) & 3U); i++)
+	{
+		if (in[i] < mask[2U * i] || in[i] > mask[2U * i + 1U])
+		{
+			return i;
+		}
+	}
+
+	{
+		const v4i8 * w = (const v4i8 *) (in + i);
+		uint32_t words = (length - i) / 4U;
+
+		for (k = 0; k < words; k++)
+		{
+			uint32_t m[2];
+			v4i8 lo;
+			v4i8 hi;
+			int out;
+
+			__builtin_memcpy(m, &(mask[2U * (i + 4U * k)]), sizeof(m));
+			lo = __builtin_mips_precrq_qb_ph((v2i16) (m[1] << 8),
+				(v2i16) (m[0] << 8));
+			hi = __builtin_mips_precrq_qb_ph((v2i16) m[1], (v2i16) m[0]);
+
+			out = __builtin_mips_cmpgu_lt_qb(w[k], lo)
+				| __builtin_mips_cmpgu_lt_qb(hi, w[k]);
+			if (out)
+			{
+				return i + 4U * k + (uint32_t) __builtin_ctz(out);
+			}
+		}
+		i += 4U * words;
+	}
+
+	for (; i < length; i++)
+	{
+		if (in[i] < mask[2U * i] || in[i] > mask[2U * i + 1U])
+		{
+			return i;
+		}
+	}
+	return length;
+}
+
+void
+dsp_sums (const uint8_t * in, uint32_t length, uint64_t * sum,
+	uint64_t * squares)
+{
+	// DPAU.H.QBL / QBR multiply two byte pairs and add both products to a
+	// 64 bit accumulator. Against ones they sum, against themselves they
+	// square and sum.
+	const v4i8 ones = { 1, 1, 1, 1 };
+	a64 s = 0;
+	a64 q = 0;
+	uint32_t i;
+
+	for (; length && ((uintptr_t) in & 3U); in++, length--)
+	{
+		s += *in;
+		q += (uint32_t) *in * *in;
+	}
+
+	{
+		const v4i8 * w = (const v4i8 *) in;
+
+		for (i = 0; i < length / 4U; i++)
+		{
+			s = __builtin_mips_dpau_h_qbl(s, w[i], ones);
+			s = __builtin_mips_dpau_h_qbr(s, w[i], ones);
+			q = __builtin_mips_dpau_h_qbl(q, w[i], w[i]);
+			q = __builtin_mips_dpau_h_qbr(q, w[i], w[i]);
+		}
+	}
+
+	for (i = length & ~3U; i < length; i++)
+	{
+		s += in[i];
+		q += (uint32_t) in[i] * in[i];
+	}
+
+	*sum += (uint64_t) s;
+	*squares += (uint64_t) q;
+}
+
+void
+dsp_accumulate (uint16_t * acc, const uint8_t * in, uint32_t length)
+{
+	// PRECEU.PH.QBR / QBL widen the low and high byte pairs of a word to
+	// halfwords, ADDQ.PH adds two halfword sums at a time
+	const v4i8 * w = (const v4i8 *) in;
+	v2i16 * sum = (v2i16 *) acc;
+	uint32_t words = length / 4U;
+	uint32_t i;
+
+	for (i = 0; i < words; i++)
+	{
+		sum[2U * i] = __builtin_mips_addq_ph(sum[2U * i],
+			__builtin_mips_preceu_ph_qbr(w[i]));
+		sum[2U * i + 1U] = __builtin_mips_addq_ph(sum[2U * i + 1U],
+			__builtin_mips_preceu_ph_qbl(w[i]));
+	}
+
+	for (i = words * 4U; i < length; i++)
+	{
+		acc[i] += in[i];
+	}
+}
+
+#else
+
+void
+dsp_minmax (const uint8_t * in, uint32_t length, uint8_t * min, uint8_t * max)
+{
+	uint8_t lo = *min;
+	uint8_t hi = *max;
+
+	for (; length; in++, length--)
+	{
+		lo = (*in < lo) ? *in : lo;
+		hi = (*in > hi) ? *in : hi;
+	}
+
+	*min = lo;
+	*max = hi;
+}
+
+uint32_t
+dsp_find_outside (const uint8_t * in, uint32_t length, uint8_t lo,
+	uint8_t hi)
+{
+	uint32_t i;
+
+	for (i = 0; i < length; i++)
+	{
+		if (in[i] < lo || in[i] > hi)
+		{
+			return i;
+		}
+	}
+	return length;
+}
+
+uint32_t
+dsp_mask_find (const uint8_t * in, const uint8_t * mask, uint32_t length)
+{
+	uint32_t i;
+
+	for (i = 0; i < length; i++)
+	{
+		if (in[i] < mask[2U * i] || in[i] > mask[2U * i + 1U])
+		{
+			return i;
+		}
+	}
+	return length;
+}
+
+void
+dsp_sums (const uint8_t * in, uint32_t length, uint64_t * sum,
+	uint64_t * squares)
+{
+	uint64_t s = 0;
+	uint64_t q = 0;
+
+	for (; length; in++, length--)
+	{
+		s += *in;
+		q += (uint32_t) *in * *in;
+	}
+
+	*sum += s;
+	*squares += q;
+}
+
+void
+dsp_accumulate (uint16_t * acc, const uint8_t * in, uint32_t length)
+{
+	uint32_t i;
+
+	for (i = 0; i < length; i++)
+	{
+		acc[i] += in[i];
+	}
+}
+
+#endif
+
+void
+dsp_fold (uint32_t * wide, uint16_t * acc, uint32_t length)
+{
+	uint32_t i;
+
+	for (i = 0; i < length; i++)
+	{
+		wide[i] += acc[i];
+		acc[i] = 0;
+	}
+}
+
+void
+dsp_bin (uint16_t * column, const uint8_t * in, uint32_t length,
+	unsigned int shift)
+{
+	// A scatter, nothing to do four at a time. The saturation is a compare,
+	// not a branch.
+	uint32_t i;
+
+	for (i = 0; i < length; i++)
+	{
+		uint16_t * cell = &(column[in[i] >> shift]);
+
+		*cell += (0xFFFFU != *cell);
+	}
+}
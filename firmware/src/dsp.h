@@ -0,0 +1,62 @@
+/*
+ * Sample Processing
+ *
+ * @Company
+ *   Probe-Scope Team
+ *
+ * @File Name
+ *   dsp.h
+ *
+ * @Summary
+ *   Reductions over captured samples
+*/
+
+#ifndef DSP_H
+#define	DSP_H
+
+
+#include <stdint.h>
+
+
+#ifdef	__cplusplus
+extern "C"
+{
+#endif
+
+
+// Widen *min / *max to cover length samples at in. Start from 0xFF / 0 for
+// a fresh run, runs in several pieces are folded in one call each.
+void dsp_minmax (const uint8_t * in, uint32_t length, uint8_t * min,
+                 uint8_t * max);
+
+// Index of the first of length samples below lo or above hi, length if
+// there is none
+uint32_t dsp_find_outside (const uint8_t * in, uint32_t length, uint8_t lo,
+                           uint8_t hi);
+
+// Index of the first of length samples outside its mask, length if there
+// is none. mask holds a lower, upper limit byte pair per sample.
+uint32_t dsp_mask_find (const uint8_t * in, const uint8_t * mask,
+                        uint32_t length);
+
+// *sum += in[i], *squares += in[i] * in[i] over length samples
+void dsp_sums (const uint8_t * in, uint32_t length, uint64_t * sum,
+               uint64_t * squares);
+
+// acc[i] += in[i], wrapping. Both word aligned. 16 bit sums hold 256
+// records, fold them into 32 bit ones before that.
+void dsp_accumulate (uint16_t * acc, const uint8_t * in, uint32_t length);
+
+// wide[i] += acc[i], then acc[i] = 0
+void dsp_fold (uint32_t * wide, uint16_t * acc, uint32_t length);
+
+// column[in[i] >> shift] += 1 for length samples, stopping at 0xFFFF
+void dsp_bin (uint16_t * column, const uint8_t * in, uint32_t length,
+              unsigned int shift);
+
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* DSP_H */
@@ -0,0 +1,448 @@
+/*
+ * Spectrum Analysis
+ *
+ * @Company
+ *   Probe-Scope Team
+ *
+ * @File Name
+ *   fft.c
+ *
+ * @Summary
+ *   Fixed point FFT of captured records to magnitude bins
+*/
+
+#include "fft.h"
+
+#include <stdint.h>
+
+
+// Quarter wave of sine, fft_sine[i] = sin(2 pi i / FFT_LENGTH_MAX) in Q15.
+// Twiddles and the window of every length come from it. The compiler
+// fills it in from a Taylor series, good to Q15 over a quarter wave, so
+// there is no generator to run and no table to keep in step.
+#if FFT_LENGTH_MAX != 8192U
+#error "fft_sine is laid out for FFT_LENGTH_MAX 8192"
+#endif
+
+#define FFT_QUARTER (FFT_LENGTH_MAX / 4U)
+
+#define FFT_X(i) ((double) (i) * (3.14159265358979323846 / 4096.0))
+#define FFT_S(x) ((x) * (1.0 - (x) * (x) / 6.0 * (1.0 - (x) * (x) / 20.0 \
+	* (1.0 - (x) * (x) / 42.0 * (1.0 - (x) * (x) / 72.0 * (1.0 - (x) * (x) \
+	/ 110.0 * (1.0 - (x) * (x) / 156.0)))))))
+#define FFT_Q15(i) ((int16_t) (FFT_S(FFT_X(i)) * 32767.0 + 0.5))
+
+#define FFT_T1(i)    FFT_Q15(i),
+#define FFT_T4(i)    FFT_T1(i) FFT_T1(i + 1) FFT_T1(i + 2) FFT_T1(i + 3)
+#define FFT_T16(i)   FFT_T4(i) FFT_T4(i + 4) FFT_T4(i + 8) FFT_T4(i + 12)
+#define FFT_T64(i)   FFT_T16(i) FFT_T16(i + 16) FFT_T16(i + 32) \
+	FFT_T16(i + 48)
+#define FFT_T256(i)  FFT_T64(i) FFT_T64(i + 64) FFT_T64(i + 128) \
+	FFT_T64(i + 192)
+#define FFT_T1024(i) FFT_T256(i) FFT_T256(i + 256) FFT_T256(i + 512) \
+	FFT_T256(i + 768)
+
+static const int16_t fft_sine[FFT_QUARTER + 1U] =
+{
+	FFT_T1024(0) FFT_T1024(1024) FFT_Q15(2048)
+};
+
+
+// The butterflies work on complex Q15 values, real part first in memory.
+// With the DSP ASE (rev 2 on the microAptiv) a value is one halfword
+// pair: ADDQH_R.PH / SUBQH_R.PH add or subtract and halve both parts at
+// once, MULSAQ_S.W.PH and DPAQX_S.W.PH give the real and imaginary part
+// of a product. Builds without it (host tools) use plain C.
+
+#if defined(__XC32) && !(defined(__mips_dsp) && (__mips_dsp_rev >= 2))
+#error "fft.c wants DSP ASE rev 2, build with -mdspr2"
+#endif
+
+#if defined(__mips_dsp) && (__mips_dsp_rev >= 2)
+
+typedef short fft_c __attribute__ ((vector_size(4)));
+
+// The real part is in the right (low) half. MULSAQ takes left times left
+// minus right times right, so it is given the twiddle negated.
+typedef struct
+{
+	fft_c w;
+	fft_c wn;
+} fft_tw_t;
+
+static inline fft_c
+fft_complex (int16_t re, int16_t im)
+{
+	fft_c x = { re, im };
+	return x;
+}
+
+static inline int32_t
+fft_re (fft_c x)
+{
+	return x[0];
+}
+
+static inline int32_t
+fft_im (fft_c x)
+{
+	return x[1];
+}
+
+static inline fft_tw_t
+fft_tw (int16_t re, int16_t im)
+{
+	fft_tw_t t;
+
+	t.w = fft_complex(re, im);
+	t.wn = fft_complex((int16_t) -re, (int16_t) -im);
+	return t;
+}
+
+static inline fft_c
+fft_add (fft_c a, fft_c b)
+{
+	return __builtin_mips_addqh_r_ph(a, b);
+}
+
+static inline fft_c
+fft_sub (fft_c a, fft_c b)
+{
+	return __builtin_mips_subqh_r_ph(a, b);
+}
+
+static inline fft_c
+fft_mul (fft_c x, fft_tw_t t)
+{
+	long long re = __builtin_mips_mulsaq_s_w_ph(0, x, t.wn);
+	long long im = __builtin_mips_dpaqx_s_w_ph(0, x, t.w);
+
+	return fft_complex((int16_t) __builtin_mips_extr_r_w(re, 16),
+		(int16_t) __builtin_mips_extr_r_w(im, 16));
+}
+
+static inline uint32_t
+fft_reverse (uint32_t i, unsigned int bits)
+{
+	// BITREV reverses the low 16 bits
+	return (uint32_t) __builtin_mips_bitrev((int) i) >> (16U - bits);
+}
+
+#else
+
+typedef struct
+{
+	int16_t re;
+	int16_t im;
+} fft_c;
+
+typedef struct
+{
+	fft_c w;
+} fft_tw_t;
+
+static inline fft_c
+fft_complex (int16_t re, int16_t im)
+{
+	fft_c x = { re, im };
+	return x;
+}
+
+static inline int32_t
+fft_re (fft_c x)
+{
+	return x.re;
+}
+
+static inline int32_t
+fft_im (fft_c x)
+{
+	return x.im;
+}
+
+static inline fft_tw_t
+fft_tw (int16_t re, int16_t im)
+{
+	fft_tw_t t;
+
+	t.w = fft_complex(re, im);
+	return t;
+}
+
+static inline fft_c
+fft_add (fft_c a, fft_c b)
+{
+	return fft_complex((int16_t) ((a.re + b.re + 1) >> 1),
+		(int16_t) ((a.im + b.im + 1) >> 1));
+}
+
+static inline fft_c
+fft_sub (fft_c a, fft_c b)
+{
+	return fft_complex((int16_t) ((a.re - b.re + 1) >> 1),
+		(int16_t) ((a.im - b.im + 1) >> 1));
+}
+
+static inline fft_c
+fft_mul (fft_c x, fft_tw_t t)
+{
+	int32_t re = (int32_t) x.re * t.w.re - (int32_t) x.im * t.w.im;
+	int32_t im = (int32_t) x.re * t.w.im + (int32_t) x.im * t.w.re;
+
+	return fft_complex((int16_t) ((re + 0x4000) >> 15),
+		(int16_t) ((im + 0x4000) >> 15));
+}
+
+static inline uint32_t
+fft_reverse (uint32_t i, unsigned int bits)
+{
+	i = ((i >> 1) & 0x5555U) | ((i & 0x5555U) << 1);
+	i = ((i >> 2) & 0x3333U) | ((i & 0x3333U) << 2);
+	i = ((i >> 4) & 0x0F0FU) | ((i & 0x0F0FU) << 4);
+	i = ((i >> 8) & 0x00FFU) | ((i & 0x00FFU) << 8);
+	return i >> (16U - bits);
+}
+
+#endif
+
+static void
+fft_cos_sin (uint32_t index, int16_t * c, int16_t * s)
+{
+	// Angle 2 pi index / FFT_LENGTH_MAX, by quadrant
+	uint32_t r = index % FFT_QUARTER;
+
+	switch ((index / FFT_QUARTER) & 3U)
+	{
+		case 0:
+			*s = fft_sine[r];
+			*c = fft_sine[FFT_QUARTER - r];
+			break;
+
+		case 1:
+			*s = fft_sine[FFT_QUARTER - r];
+			*c = (int16_t) -fft_sine[r];
+			break;
+
+		case 2:
+			*s = (int16_t) -fft_sine[r];
+			*c = (int16_t) -fft_sine[FFT_QUARTER - r];
+			break;
+
+		default:
+			*s = (int16_t) -fft_sine[FFT_QUARTER - r];
+			*c = fft_sine[r];
+			break;
+	}
+}
+
+static fft_tw_t
+fft_twiddle (uint32_t index)
+{
+	// e^(-j angle)
+	int16_t c;
+	int16_t s;
+
+	fft_cos_sin(index, &c, &s);
+	return fft_tw(c, (int16_t) -s);
+}
+
+static unsigned int
+fft_bits (uint32_t length)
+{
+	unsigned int bits = 0;
+
+	while ((1UL << bits) < length)
+	{
+		bits++;
+	}
+	return bits;
+}
+
+static uint32_t
+fft_sqrt (uint32_t x)
+{
+	uint32_t root = 0;
+	uint32_t bit = 1UL << 30;
+
+	while (bit > x)
+	{
+		bit >>= 2;
+	}
+
+	while (bit)
+	{
+		if (x >= root + bit)
+		{
+			x -= root + bit;
+			root = (root >> 1) + bit;
+		}
+		else
+		{
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+
+	return root;
+}
+
+static uint8_t
+fft_db (uint64_t power)
+{
+	// 255 + 2 * 10 log10(power / 2^28). log2 from the top bit, plus
+	// x + 0.3466 x (1 - x) for log2(1 + x) of the rest.
+	uint32_t msb;
+	uint32_t t;
+	int32_t log2q16;
+	int32_t v;
+
+	if (0 == power)
+	{
+		return 0;
+	}
+
+	msb = 63U - (uint32_t) __builtin_clzll(power);
+	t = (uint32_t) ((msb >= 16U) ? (power >> (msb - 16U))
+		: (power << (16U - msb))) - 65536U;
+	log2q16 = (int32_t) ((msb << 16) + t
+		+ ((((t * (65536U - t)) >> 16) * 22713U) >> 16));
+
+	// 20 log10(2) = 6.0206 is 1541 in Q8
+	v = 255 + (int32_t) (((int64_t) (log2q16 - (28 << 16)) * 1541
+		+ (1 << 23)) >> 24);
+	return (uint8_t) ((v < 0) ? 0 : ((v > 255) ? 255 : v));
+}
+
+void
+fft_load (int16_t * work, const uint8_t * in, uint32_t length,
+	unsigned int window)
+{
+	// Samples to Q15 around mid scale, half of full scale so the first
+	// butterflies have room
+	fft_c * x = (fft_c *) work;
+	unsigned int bits = fft_bits(length);
+	uint32_t step = FFT_LENGTH_MAX / length;
+	uint32_t i;
+
+	for (i = 0; i < length; i++)
+	{
+		int32_t s = ((int32_t) in[i] - 128) * 128;
+
+		if (FFT_WINDOW_HANN == window)
+		{
+			// (1 - cos) / 2
+			int16_t c;
+			int16_t sn;
+
+			fft_cos_sin(i * step, &c, &sn);
+			s = (s * ((32768 - c) >> 1)) >> 15;
+		}
+
+		x[fft_reverse(i, bits)] = fft_complex((int16_t) s, 0);
+	}
+}
+
+static void
+fft_pass2 (fft_c * x, uint32_t length)
+{
+	uint32_t k;
+
+	for (k = 0; k < length; k += 2U)
+	{
+		fft_c a = x[k];
+		fft_c b = x[k + 1U];
+
+		x[k] = fft_add(a, b);
+		x[k + 1U] = fft_sub(a, b);
+	}
+}
+
+static void
+fft_pass4 (fft_c * x, uint32_t length, uint32_t half)
+{
+	// Two radix-2 stages in one pass over the data, butterfly spans half
+	// and 2 * half, so each point is loaded and stored once for both.
+	// The second stage's odd twiddle is the even one turned a quarter.
+	uint32_t step = FFT_LENGTH_MAX / (4U * half);
+	uint32_t j;
+	uint32_t k;
+
+	for (j = 0; j < half; j++)
+	{
+		fft_tw_t w1 = fft_twiddle(2U * j * step);
+		fft_tw_t w2 = fft_twiddle(j * step);
+		fft_tw_t w3 = fft_twiddle(j * step + FFT_QUARTER);
+
+		for (k = j; k < length; k += 4U * half)
+		{
+			fft_c a = x[k];
+			fft_c b = fft_mul(x[k + half], w1);
+			fft_c c = x[k + 2U * half];
+			fft_c d = fft_mul(x[k + 3U * half], w1);
+			fft_c a1 = fft_add(a, b);
+			fft_c b1 = fft_sub(a, b);
+			fft_c c1 = fft_mul(fft_add(c, d), w2);
+			fft_c d1 = fft_mul(fft_sub(c, d), w3);
+
+			x[k] = fft_add(a1, c1);
+			x[k + half] = fft_add(b1, d1);
+			x[k + 2U * half] = fft_sub(a1, c1);
+			x[k + 3U * half] = fft_sub(b1, d1);
+		}
+	}
+}
+
+void
+fft_run (int16_t * work, uint32_t length)
+{
+	// Every stage halves, so the result is the transform / length. An odd
+	// number of stages starts with a plain radix-2 pass.
+	fft_c * x = (fft_c *) work;
+	uint32_t half = 1;
+
+	if (fft_bits(length) & 1U)
+	{
+		fft_pass2(x, length);
+		half = 2;
+	}
+
+	for (; half < length; half *= 4U)
+	{
+		fft_pass4(x, length, half);
+	}
+}
+
+void
+fft_bins (const int16_t * work, uint32_t length, unsigned int window,
+	unsigned int format, uint8_t * out)
+{
+	// Single sided amplitudes: x2 for the mirrored half, except DC, and
+	// x2 more for the Hann window's coherent gain
+	const fft_c * x = (const fft_c *) work;
+	unsigned int gain = (FFT_WINDOW_HANN == window) ? 2U : 1U;
+	uint32_t k;
+
+	for (k = 0; k < length / 2U; k++)
+	{
+		int32_t re = fft_re(x[k]);
+		int32_t im = fft_im(x[k]);
+		uint32_t power = (uint32_t) (re * re + im * im);
+		unsigned int shift = gain - (0U == k);
+
+		if (FFT_FORMAT_LOG == format)
+		{
+			out[k] = fft_db((uint64_t) power << (2U * shift));
+		}
+		else
+		{
+			uint32_t amp = fft_sqrt(power) << shift;
+
+			if (amp > 0xFFFFU)
+			{
+				amp = 0xFFFFU;
+			}
+			out[2U * k] = (uint8_t) amp;
+			out[2U * k + 1U] = (uint8_t) (amp >> 8);
+		}
+	}
+}
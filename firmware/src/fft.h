@@ -0,0 +1,62 @@
+/*
+ * Spectrum Analysis
+ *
+ * @Company
+ *   Probe-Scope Team
+ *
+ * @File Name
+ *   fft.h
+ *
+ * @Summary
+ *   Fixed point FFT of captured records to magnitude bins
+*/
+
+#ifndef FFT_H
+#define	FFT_H
+
+
+#include <stdint.h>
+
+
+// Transform lengths, powers of two
+#define FFT_LENGTH_MIN 1024U
+#define FFT_LENGTH_MAX 8192U
+
+// Window applied to the record
+#define FFT_WINDOW_RECT 0U
+#define FFT_WINDOW_HANN 1U
+
+// Bin format. Linear bins are 16 bit amplitudes in 1/128 sample codes, a
+// full scale sine reads about 16256. Log bins are 8 bit in 0.5 dB steps,
+// 255 is a full scale sine.
+#define FFT_FORMAT_LINEAR 0U
+#define FFT_FORMAT_LOG    1U
+
+// Work buffer for a transform of n points, complex Q15
+#define FFT_WORK_SIZE(n) ((n) * 2U * sizeof(int16_t))
+
+
+#ifdef	__cplusplus
+extern "C"
+{
+#endif
+
+
+// Window length samples into work, in the bit reversed order the
+// transform wants
+void fft_load (int16_t * work, const uint8_t * in, uint32_t length,
+               unsigned int window);
+
+// In place, scaled by 1 / length so nothing overflows
+void fft_run  (int16_t * work, uint32_t length);
+
+// length / 2 bins to out: 2 bytes each, little endian, or 1 if log
+void fft_bins (const int16_t * work, uint32_t length, unsigned int window,
+               unsigned int format, uint8_t * out);
+
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* FFT_H */
@@ -1,777 +1,1741 @@
-/*
- * Host Interface
- * 
- * @Company
- *   Probe-Scope Team
- * 
- * @File Name
- *   interface.c
- * 
- * @Summary
- *   Interface according to Probe-Scope CDC Interface Spec v1.0.docx
-*/
-
-#include "interface.h"
-
-#include "app.h"
-#include "config/default/driver/spi/drv_spi.h"
-#include "config/default/driver/spi/drv_spi_definitions.h"
-#include "config/default/driver/i2c/drv_i2c.h"
-#include "config/default/driver/i2c/drv_i2c_definitions.h"
-#include "config/default/peripheral/i2c/plib_i2c4.h"
-#include "config/default/peripheral/i2c/plib_i2c_master.h"
-#include "FreeRTOS.h"
-#include "ccbysa3.h"
-
-#include <stdbool.h>
-#include <stddef.h>
-#include <stdint.h>
-#include <string.h>
-
-static if_data_t if_data;
-
-static uint8_t __attribute__((coherent, aligned(16))) out_buffer[MAX_OUTGOING_MESSAGE];
-static uint8_t in_buffer[MAX_INCOMING_MESSAGE];
-
-
-static void if_rx_task (void);
-static void if_tx_task (void);
-
-static void if_send_samp_data (void);
-static void if_send_trigger (void);
-
-static void if_vm_dispatch (void);
-static void if_vm_pic_op   (uint32_t address, uint32_t length);
-static void if_vm_dac_op   (uint32_t address, uint32_t length);
-static void if_vm_fpga_op  (uint32_t address, uint32_t length);
-static void if_vm_afe_op   (uint32_t address, uint32_t length);
-static void if_vm_respstp  (uint32_t length);
-
-
-void
-if_init (void)
-{
-	
-	if_data.state = IF_STATE_INIT;
-	
-	if_data.tx_state = IF_TX_STATE_WAIT;
-	if_data.tx_error_count = 0;
-	if_data.tx_error_flag = false;
-	
-	if_data.rx_state = IF_RX_STATE_WAIT;
-	if_data.rx_error_count = 0;
-	if_data.rx_error_flag = false;
-	
-	memset(&(if_data.rx_msg), 0, sizeof(if_data.rx_msg));
-	
-	if_data.h_spi_fpga = DRV_HANDLE_INVALID;
-	if_data.h_spi_afe = DRV_HANDLE_INVALID;
-	if_data.h_i2c_dac = DRV_HANDLE_INVALID;
-}
-
-void
-if_task (void)
-{
-	switch (if_data.state)
-	{
-		case IF_STATE_INIT:
-			if_data.state = IF_STATE_WAIT;
-			
-			// init fpga spi
-			if (DRV_HANDLE_INVALID == if_data.h_spi_fpga)
-			{
-				if_data.h_spi_fpga =
-					DRV_SPI_Open(DRV_SPI_INDEX_0, DRV_IO_INTENT_EXCLUSIVE);
-			}
-			if (DRV_HANDLE_INVALID == if_data.h_spi_fpga)
-			{
-				if_data.state = IF_STATE_INIT;
-			}
-			else
-			{
-				// bare minimum configuration for now
-			}
-			
-			// init afe (filter/pga) spi
-			if (DRV_HANDLE_INVALID == if_data.h_spi_afe)
-			{
-				if_data.h_spi_afe =
-					DRV_SPI_Open(DRV_SPI_INDEX_1, DRV_IO_INTENT_EXCLUSIVE);
-			}
-			if (DRV_HANDLE_INVALID == if_data.h_spi_afe)
-			{
-				if_data.state = IF_STATE_INIT;
-			}
-			else
-			{
-				// bare minimum configuration for now
-			}
-			
-			// init dac i2c
-			if (DRV_HANDLE_INVALID == if_data.h_i2c_dac)
-			{
-				if_data.h_i2c_dac =
-					DRV_I2C_Open(DRV_I2C_INDEX_0, DRV_IO_INTENT_EXCLUSIVE);
-			}
-			if (DRV_HANDLE_INVALID == if_data.h_i2c_dac)
-			{
-				if_data.state = IF_STATE_INIT;
-			}
-			else
-			{
-				// bare minimum configuration for now
-			}
-			
-			break;
-		
-		case IF_STATE_WAIT:
-			if_rx_task();
-
-			if (IF_RX_STATE_MSG_READY == if_data.rx_state)
-			{
-				if_data.state = IF_STATE_PROCESS_HOST_MSG;
-			}
-			
-			if (APP_STATE_TRIGGERED == appData.state)
-			{
-				appData.state = APP_STATE_WAIT_TRIGGER;
-				
-				if (if_data.wait_trigger)
-				{
-					if_send_samp_data();
-					if_data.wait_trigger = false;
-				}
-				else
-				{
-					//if_send_trigger();
-				}
-				
-				if_data.state = IF_STATE_SEND_HW_MSG;
-			}
-			break;
-		
-		case IF_STATE_PROCESS_HOST_MSG:
-			switch (if_data.rx_msg.command)
-			{
-				case IF_CMD_REQ_SAMP_DATA:
-					if_data.wait_trigger = true;
-					break;
-				
-				case IF_CMD_WRITE_REGS:
-				case IF_CMD_READ_REGS:
-					if_vm_dispatch();
-					break;
-				
-				default:
-					// real bad
-					break;
-			}
-			
-			if_data.rx_state = IF_RX_STATE_WAIT;
-			if_data.state = IF_STATE_SEND_HW_MSG;
-			break;
-		
-		case IF_STATE_SEND_HW_MSG:
-			if (IF_TX_STATE_WAIT == if_data.tx_state)
-			{
-				if_data.state = IF_STATE_WAIT;
-			}
-			else
-			{
-				if_tx_task();
-			}
-			break;
-		
-		default:
-			if_data.state = IF_STATE_INIT;
-			break;
-	}
-}
-
-
-static int
-get_msg_data_len (if_message_t msg)
-{
-	int data_len = 0;
-	switch (msg.type)
-	{
-		case IF_MSG_COMMAND:
-			switch (msg.command)
-			{
-				case IF_CMD_REQ_SAMP_DATA:
-					data_len = 0;
-					break;
-
-				case IF_CMD_WRITE_REGS:
-					data_len = 11;
-					break;
-
-				case IF_CMD_READ_REGS:
-					data_len = 10;
-					break;
-				
-				case IF_CMD_TRIGGERED:
-					data_len = 0;
-					break;
-
-				default:
-					data_len = -1;
-					break;
-			}
-			break;
-		
-		case IF_MSG_RESULT:
-			switch (msg.command)
-			{
-				case IF_CMD_REQ_SAMP_DATA:
-					data_len = 6;
-					break;
-
-				case IF_CMD_WRITE_REGS:
-					data_len = 5;
-					break;
-
-				case IF_CMD_READ_REGS:
-					data_len = 6;
-					break;
-
-				default:
-					data_len = -1;
-					break;
-			}
-			break;
-		
-		default:
-			data_len = -1;
-			break;
-	}
-	return data_len;
-}
-
-static int
-get_msg_var_data_len (if_message_t msg)
-{
-	int var_data_len = 0;
-	switch (msg.type)
-	{
-		case IF_MSG_COMMAND:
-			switch (msg.command)
-			{
-				case IF_CMD_REQ_SAMP_DATA:
-					var_data_len = 0;
-					break;
-
-				case IF_CMD_WRITE_REGS:
-					var_data_len = msg.data.cmd_data_write_regs.write_length;
-					break;
-
-				case IF_CMD_READ_REGS:
-					var_data_len = 0;
-					break;
-				
-				case IF_CMD_TRIGGERED:
-					var_data_len = 0;
-					break;
-
-				default:
-					var_data_len = -1;
-					break;
-			}
-			break;
-		
-		case IF_MSG_RESULT:
-			switch (msg.command)
-			{
-				case IF_CMD_REQ_SAMP_DATA:
-					var_data_len =
-						msg.data.res_data_req_samp_data.sample_data_length;
-					break;
-
-				case IF_CMD_WRITE_REGS:
-					var_data_len = 0;
-					break;
-
-				case IF_CMD_READ_REGS:
-					var_data_len = msg.data.res_data_read_regs.read_length;
-					break;
-
-				default:
-					var_data_len = -1;
-					break;
-			}
-			break;
-		
-		default:
-			var_data_len = -1;
-			break;
-	}
-	return var_data_len;
-}
-
-
-static void
-if_rx_task (void)
-{
-	switch (if_data.rx_state)
-	{
-		case IF_RX_STATE_WAIT:
-			if (true == comms_receive_auto(gp_comms, in_buffer,
-				MAX_INCOMING_MESSAGE, IF_END_MESSAGE))
-			{
-				if_data.rx_state = IF_RX_STATE_RECEIVING;
-			}
-			break;
-		
-		case IF_RX_STATE_RECEIVING:
-			if (!gp_comms->rx_auto)
-			{
-				if (gp_comms->rx_auto_fail)
-				{
-					if_data.rx_error_count++;
-					if_data.rx_error_flag = true;
-					if_data.rx_state = IF_RX_STATE_WAIT;
-				}
-				else
-				{
-					if_data.rx_state = IF_RX_STATE_DECODE;
-				}
-			}
-			break;
-		
-		case IF_RX_STATE_DECODE:
-			if (in_buffer[0] != IF_START_MESSAGE)
-			{
-				if_data.rx_error_count++;
-				if_data.rx_error_flag = true;
-				if_data.rx_state = IF_RX_STATE_WAIT;
-				break;
-			}
-			
-			if_data.rx_msg.type = in_buffer[1];
-			if (IF_MSG_COMMAND != if_data.rx_msg.type)
-			{
-				if_data.rx_error_count++;
-				if_data.rx_error_flag = true;
-				if_data.rx_state = IF_RX_STATE_WAIT;
-				break;
-			}
-			
-			if_data.rx_msg.command = in_buffer[2];
-			
-			int data_len = get_msg_data_len(if_data.rx_msg);
-			if (data_len < 0)
-			{
-				if_data.rx_error_count++;
-				if_data.rx_error_flag = true;
-				if_data.rx_state = IF_RX_STATE_WAIT;
-				break;
-			}
-			
-			unsigned int i, o = 0;
-			for (i = 0; i < data_len; i++)
-			{
-				if (IF_ESCAPE == in_buffer[3 + i + o])
-				{
-					o++;
-				}
-				
-				if_data.rx_msg.data.bytes[i] = in_buffer[3 + i + o];
-			}
-			
-			
-			int var_data_len = get_msg_var_data_len(if_data.rx_msg);
-			if (var_data_len < 0 || var_data_len > 256)
-			{
-				if_data.rx_error_count++;
-				if_data.rx_error_flag = true;
-				if_data.rx_state = IF_RX_STATE_WAIT;
-				break; 
-			}
-			
-			for (i = 0; i < var_data_len; i++)
-			{
-				if (IF_ESCAPE == in_buffer[3 + data_len + i + o])
-				{
-					o++;
-				}
-				
-				in_buffer[i] = in_buffer[3 + data_len + i + o];
-			}
-			if_data.rx_msg.var_data = in_buffer;
-			if_data.rx_msg.length = var_data_len;
-			
-			if_data.rx_state = IF_RX_STATE_MSG_READY;
-			break;
-		
-		case IF_RX_STATE_MSG_READY:
-		default:
-			break;
-	}
-}
-
-static void
-if_tx_task (void)
-{
-	switch (if_data.tx_state)
-	{
-		case IF_TX_STATE_ENCODE:
-			out_buffer[0] = IF_START_MESSAGE;
-			out_buffer[1] = if_data.tx_msg.type;
-			out_buffer[2] = if_data.tx_msg.command;
-			
-			int data_len = get_msg_data_len(if_data.tx_msg);
-			int var_data_len = get_msg_var_data_len(if_data.tx_msg);
-			
-			unsigned int i, o = 0;
-			for (i = 0; i < data_len; i++)
-			{
-				uint8_t c = if_data.tx_msg.data.bytes[i];
-				if (IF_ESCAPE == c || IF_END_MESSAGE == c
-					|| IF_END_BLOCK == c || IF_START_MESSAGE == c)
-				{
-					out_buffer[3 + i + o] = IF_ESCAPE;
-					o++;
-				}
-				
-				out_buffer[3 + i + o] = if_data.tx_msg.data.bytes[i];
-			}
-			for (i = 0; i < var_data_len; i++)
-			{
-				uint8_t c = if_data.tx_msg.var_data[i];
-				if (IF_ESCAPE == c || IF_END_MESSAGE == c
-					|| IF_END_BLOCK == c || IF_START_MESSAGE == c)
-				{
-					out_buffer[3 + data_len + i + o] = IF_ESCAPE;
-					o++;
-				}
-				
-				out_buffer[3 + data_len + i + o] = if_data.tx_msg.var_data[i];
-			}
-			out_buffer[3 + data_len + var_data_len + o] = IF_END_MESSAGE;
-			if_data.tx_msg.length = 3 + data_len + var_data_len + o + 1;
-			
-			if_data.tx_state = IF_TX_STATE_TRANSMIT;
-			break;
-		
-		case IF_TX_STATE_TRANSMIT:
-			if(comms_transmit(gp_comms, out_buffer, if_data.tx_msg.length))
-			{
-				if_data.tx_state = IF_TX_STATE_TRANSMITTING;
-			}
-		
-		case IF_TX_STATE_TRANSMITTING:
-			if (gp_comms->transmitState == RXTX_READY)
-			{
-				if_data.tx_state = IF_TX_STATE_WAIT;
-			}
-			break;
-		
-		case IF_TX_STATE_WAIT:
-		default:
-			break;
-	}
-}
-
-
-static void
-if_send_samp_data (void)
-{
-	if_data.tx_msg.type = IF_MSG_RESULT;
-	if_data.tx_msg.command = IF_CMD_REQ_SAMP_DATA;
-	
-	if_data.tx_msg.data.res_data_req_samp_data.sample_data_fi =
-		SAMPLE_DATA_FI;
-	if_data.tx_msg.data.res_data_req_samp_data.sample_data_length_fi =
-		SAMPLE_DATA_LENGTH_FI;
-	if_data.tx_msg.data.res_data_req_samp_data.sample_data_length = SAMPLES;
-	
-	if_data.tx_msg.var_data = appData.buf.data;
-	
-	if_data.tx_state = IF_TX_STATE_ENCODE;
-}
-
-static void
-if_send_trigger (void)
-{
-	if_data.tx_msg.type = IF_MSG_COMMAND;
-	if_data.tx_msg.command = IF_CMD_TRIGGERED;
-	if_data.tx_state = IF_TX_STATE_ENCODE;
-}
-
-
-static void
-if_vm_dispatch (void)
-{
-	// Dispatch a read or write register command to the correct driver
-	
-	uint32_t address, length;
-	
-	if (IF_CMD_WRITE_REGS == if_data.rx_msg.command)
-	{
-		address = if_data.rx_msg.data.cmd_data_write_regs.write_address;
-		length  = if_data.rx_msg.data.cmd_data_write_regs.write_length;
-	}
-	else if (IF_CMD_READ_REGS == if_data.rx_msg.command)
-	{
-		address = if_data.rx_msg.data.cmd_data_read_regs.read_address;
-		length  = if_data.rx_msg.data.cmd_data_read_regs.read_length;
-	}
-	else
-	{
-		// Someone called this at the wrong time, do nothing
-		return;
-	}
-	
-	if ((IF_VM_PIC_START <= address)
-		&& (IF_VM_PIC_END >= (address + length - 1)))
-	{
-		if_vm_pic_op(address - IF_VM_PIC_START, length);
-	}
-	else if ((IF_VM_FPGA_START <= address)
-		&& (IF_VM_FPGA_END >= (address + length - 1)))
-	{
-		if_vm_fpga_op(address - IF_VM_FPGA_START, length);
-	}
-	else if ((IF_VM_AFE_START <= address)
-		&& (IF_VM_AFE_END >= (address + length - 1)))
-	{
-		if_vm_afe_op(address - IF_VM_AFE_START, length);
-	}
-	else if ((IF_VM_DAC_START <= address)
-		&& (IF_VM_DAC_END >= (address + length - 1)))
-	{
-		if_vm_dac_op(address - IF_VM_DAC_START, length);
-	}
-	else
-	{
-		// Invalid address and/or length
-		if_vm_respstp(0);
-	}
-}
-
-static void
-if_vm_pic_op (uint32_t address, uint32_t length)
-{
-	// Process read/write command that maps to PIC memory.
-	// This MUST only be called by if_vm_dispatch, as all the parameter
-	// validation is done there.
-	
-	if (IF_CMD_WRITE_REGS == if_data.rx_msg.command)
-	{
-		memcpy(&(if_data.vm_pic_buf[address]), if_data.rx_msg.var_data, length);
-		if_vm_respstp(length);
-	}
-	else if (IF_CMD_READ_REGS == if_data.rx_msg.command)
-	{
-		if_vm_respstp(length);
-		if_data.tx_msg.var_data = &(if_data.vm_pic_buf[address]);
-	}
-}
-
-static void
-if_vm_dac_op (uint32_t address, uint32_t length)
-{
-	// Process read/write command that maps to DAC memory.
-	// This MUST only be called by if_vm_dispatch, as all the parameter
-	// validation is done there.
-	uint8_t ibuf[8] = {0};
-	uint16_t countz[4] = {0};
-	uint16_t addr = DAC_ADDRESS;
-	
-	if (IF_CMD_WRITE_REGS == if_data.rx_msg.command)
-	{
-		// Minimalist implementation: write 0xAA to first virtual address and
-		// the PIC will send out Mark's recommended values to the DAC.
-		// Memory mapping it will take a little more effort since it's not
-		// really set up that way on the DAC, for writes at least.
-		
-		memcpy(&(if_data.vm_dac_buf[address]), if_data.rx_msg.var_data,
-			length);
-		
-		if ((0 == address) && (0xAA == if_data.vm_dac_buf[0]))
-		{
-			// wait to update outputs
-			LDACn_Set();
-
-			// set vref
-			// A, B, C use internal 2.048V reference, D uses VDD (5V)
-			ibuf[0] = 0b10001110;
-			if (!DRV_I2C_WriteTransfer(if_data.h_i2c_dac, addr, ibuf, 1))
-			{
-				if_vm_respstp(0);
-				return;
-			}
-
-			// set gain to 1x for all
-			ibuf[0] = 0b11000000;
-			if (!DRV_I2C_WriteTransfer(if_data.h_i2c_dac, addr, ibuf, 1))
-			{
-				if_vm_respstp(0);
-				return;
-			}
-
-			// set outputs (fast write)
-			// A = 1200
-			// B = 1000
-			// C = 1012
-			// D = 255
-			// all PD = 0b00
-			countz[0] = cbs_endflip(1200);
-			countz[1] = cbs_endflip(1000);
-			countz[2] = cbs_endflip(1612);
-			countz[3] = cbs_endflip(0);
-			if (!DRV_I2C_WriteTransfer(if_data.h_i2c_dac, DAC_ADDRESS,
-				(void *) countz, 8))
-			{
-				if_vm_respstp(0);
-				return;
-			}
-
-			// update outputs
-			LDACn_Clear();
-
-			// Response of 0x55 is success, any other is failure
-			if_vm_respstp(0x55555555);
-		}
-		else if (2 == address && 8 == length)
-		{
-			// wait to update outputs
-			LDACn_Set();
-			
-			// set outputs (fast write)
-			countz[0] = cbs_endflip(((uint16_t *)if_data.vm_dac_buf)[1]);
-			countz[1] = cbs_endflip(((uint16_t *)if_data.vm_dac_buf)[2]);
-			countz[2] = cbs_endflip(((uint16_t *)if_data.vm_dac_buf)[3]);
-			countz[3] = cbs_endflip(((uint16_t *)if_data.vm_dac_buf)[4]);
-			if (!DRV_I2C_WriteTransfer(if_data.h_i2c_dac, DAC_ADDRESS,
-				(void *) countz, 8))
-			{
-				if_vm_respstp(0);
-				return;
-			}
-
-			// update outputs
-			LDACn_Clear();
-			if_vm_respstp(8);
-		}
-	}
-	else if (IF_CMD_READ_REGS == if_data.rx_msg.command)
-	{
-		// not implemented
-	}
-}
-
-static void
-if_vm_fpga_op (uint32_t address, uint32_t length)
-{
-	// Process read/write command that maps to FPGA memory.
-	// This MUST only be called by if_vm_dispatch, as all the parameter
-	// validation is done there.
-	
-	if (IF_CMD_WRITE_REGS == if_data.rx_msg.command)
-	{
-		memcpy(&(if_data.vm_fpga_buf[address]), if_data.rx_msg.var_data,
-			length);
-		
-		if (DRV_SPI_WriteTransfer(if_data.h_spi_fpga, if_data.vm_fpga_buf,
-			IF_VM_FPGA_LENGTH))
-		{
-			if_vm_respstp(IF_VM_FPGA_LENGTH);
-		}
-		else
-		{
-			// spi failure for some reason
-			if_vm_respstp(0);
-		}
-	}
-	else if (IF_CMD_READ_REGS == if_data.rx_msg.command)
-	{
-		if (DRV_SPI_ReadTransfer(if_data.h_spi_fpga, if_data.vm_fpga_buf,
-			IF_VM_FPGA_LENGTH))
-		{
-			if_vm_respstp(length);
-			if_data.tx_msg.var_data = &(if_data.vm_fpga_buf[address]);
-		}
-		else
-		{
-			// spi failure for some reason
-			if_vm_respstp(0);
-		}
-	}
-}
-
-static void
-if_vm_afe_op (uint32_t address, uint32_t length)
-{
-	// Process read/write command that maps to AFE memory.
-	// This MUST only be called by if_vm_dispatch, as all the parameter
-	// validation is done there.
-	
-	uint8_t flip[2];
-	uint8_t read[2] = { 0 };
-	
-	if (IF_CMD_WRITE_REGS == if_data.rx_msg.command)
-	{
-		memcpy(&(if_data.vm_afe_buf[address]), if_data.rx_msg.var_data,
-			length);
-		flip[0] = cbs_reverse(if_data.vm_afe_buf[1]);
-		flip[1] = cbs_reverse(if_data.vm_afe_buf[0]);
-		flip[0] |= 0b10000000;
-		
-		if (DRV_SPI_WriteTransfer(if_data.h_spi_afe, flip, 2))
-		{
-			if_vm_respstp(2);
-		}
-		else
-		{
-			// spi failure for some reason
-			if_vm_respstp(0);
-		}
-	}
-	else if (IF_CMD_READ_REGS == if_data.rx_msg.command)
-	{
-		if (DRV_SPI_WriteReadTransfer(if_data.h_spi_afe, read, 2, flip, 2))
-		{
-			if_data.vm_afe_buf[0] = cbs_reverse(flip[1]);
-			if_data.vm_afe_buf[1] = cbs_reverse(flip[0]);
-			
-			if_vm_respstp(length);
-			if_data.tx_msg.var_data = &(if_data.vm_afe_buf[address]);
-		}
-		else
-		{
-			// spi failure for some reason
-			if_vm_respstp(0);
-		}
-	}
-}
-
-static void
-if_vm_respstp (uint32_t length)
-{
-	// Set up the appropriate response for a read or write command
-	// For write, the user still needs to set the var_data pointer
-	
-	if (IF_CMD_WRITE_REGS == if_data.rx_msg.command)
-	{
-		if_data.tx_msg.type = IF_MSG_RESULT;
-		if_data.tx_msg.command = IF_CMD_WRITE_REGS;
-		if_data.tx_msg.data.res_data_write_regs.write_length_fi =
-			WRITE_LENGTH_FI;
-		if_data.tx_msg.data.res_data_write_regs.write_length = length;
-		
-		if_data.tx_state = IF_TX_STATE_ENCODE;
-	}
-	else if (IF_CMD_READ_REGS == if_data.rx_msg.command)
-	{
-		if_data.tx_msg.type = IF_MSG_RESULT;
-		if_data.tx_msg.command = IF_CMD_READ_REGS;
-		if_data.tx_msg.data.res_data_read_regs.read_length_fi =
-			READ_LENGTH_FI;
-		if_data.tx_msg.data.res_data_read_regs.read_data_fi =
-			READ_DATA_FI;
-		if_data.tx_msg.data.res_data_read_regs.read_length = length;
-		
-		if_data.tx_state = IF_TX_STATE_ENCODE;
-	}
-}
+/*
+ * Host Interface
+ * 
+ * @Company
+ *   Probe-Scope Team
+ * 
+ * @File Name
+ *   interface.c
+ * 
+ * @Summary
+ *   Interface according to Probe-Scope CDC Interface Spec v1.0.docx
+*/
+
+#include "interface.h"
+
+#include "app.h"
+#include "ccbysa3.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+static if_data_t if_data;
+
+static uint8_t __attribute__((coherent, aligned(16)))
+	out_buffer[IF_TX_BUFFERS][IF_TX_PACKET];
+static uint8_t in_buffer[MAX_INCOMING_MESSAGE];
+
+// Coded variable data, on its way to be escaped
+static uint8_t codec_buffer[IF_TX_PACKET];
+static app_stats_t vm_stat_buf;
+static uint8_t vm_vector_buf[IF_VECTOR_OUT];
+
+// Bytes that are escaped on the way out
+#if IF_START_MESSAGE >= IF_ESCAPE_BELOW || IF_END_MESSAGE >= IF_ESCAPE_BELOW \
+	|| IF_END_BLOCK >= IF_ESCAPE_BELOW || IF_ESCAPE >= IF_ESCAPE_BELOW
+#error "if_escape() skips words with no byte below IF_ESCAPE_BELOW"
+#endif
+
+static const uint8_t if_escape_class[256] =
+{
+	[IF_START_MESSAGE] = 1,
+	[IF_END_MESSAGE]   = 1,
+	[IF_END_BLOCK]     = 1,
+	[IF_ESCAPE]        = 1
+};
+
+
+// What it takes to decode, encode and run a message, looked up by command
+// letter. Filled in from IF_COMMANDS, IF_NOTICES and IF_RESULTS, a command
+// that is not a lowercase letter does not compile.
+#define IF_CMD_BASE 0x61U   // 'a'
+#define IF_CMD_SPAN 26U
+
+typedef struct
+{
+	bool     known;
+	uint8_t  data_length;       // or IF_LEN_OWN
+	uint16_t var_offset;        // or IF_VAR_NONE, IF_VAR_OWN
+	void     (*handler) (void);
+} if_msg_desc_t;
+
+static const if_msg_desc_t * if_msg_desc (if_msg_type_t type,
+                                          uint8_t command, bool outgoing);
+static int if_msg_data_len (const if_msg_desc_t * desc,
+                            const if_message_t * msg);
+static int if_msg_var_len  (const if_msg_desc_t * desc,
+                            const if_message_t * msg);
+
+static void if_rx_task (void);
+static void if_tx_task (void);
+
+static void if_send_samp_data (void);
+static void if_send_measure (void);
+static void if_send_stream_data (void);
+static void if_send_event (uint32_t events);
+static uint32_t if_event_changes (void);
+static void if_event_seen (uint32_t events);
+static void if_send_framing (void);
+
+static void if_cmd_req_samp_data (void);
+static void if_cmd_measure (void);
+
+static void if_vm_dispatch (void);
+static bool if_vm_in       (uint32_t address, uint32_t length,
+                            uint32_t start, uint32_t end);
+static void if_vm_vector   (void);
+static void if_vm_pic_op   (uint32_t address, uint32_t length);
+static void if_vm_dac_op   (uint32_t address, uint32_t length);
+static void if_vm_fpga_op  (uint32_t address, uint32_t length);
+static void if_vm_afe_op   (uint32_t address, uint32_t length);
+static void if_vm_stat_op  (uint32_t address, uint32_t length);
+static void if_vm_hist_op  (uint32_t address, uint32_t length);
+static void if_vm_mask_op  (uint32_t address, uint32_t length);
+static void if_vm_respstp  (uint32_t length);
+
+
+#define IF_MSG_DESC(command, data_length, var_offset, handler) \
+	[(command) - IF_CMD_BASE] = { true, (data_length), (var_offset), \
+		(handler) },
+
+static const if_msg_desc_t if_command_desc[IF_CMD_SPAN] =
+{
+	IF_COMMANDS(IF_MSG_DESC)
+};
+
+static const if_msg_desc_t if_notice_desc[IF_CMD_SPAN] =
+{
+	IF_NOTICES(IF_MSG_DESC)
+};
+
+static const if_msg_desc_t if_result_desc[IF_CMD_SPAN] =
+{
+	IF_RESULTS(IF_MSG_DESC)
+};
+
+
+void
+if_init (void)
+{
+	
+	if_data.state = IF_STATE_INIT;
+	
+	if_data.framing = IF_FRAMING_ESCAPED;
+	if_data.framing_next = IF_FRAMING_ESCAPED;
+	
+	if_data.tx_state = IF_TX_STATE_WAIT;
+	if_data.tx_part = IF_TX_PART_DONE;
+	if_data.tx_framing = IF_FRAMING_ESCAPED;
+	if_data.tx_direct = false;
+	if_data.tx_buffer = 0;
+	if_data.tx_held = false;
+	if_data.tx_var_offset = 0;
+	if_data.tx_var_length = 0;
+	if_data.tx_msg.var_wrap_at = 0;
+	if_data.tx_msg.var_codec = CODEC_NONE;
+	if_data.tx_msg.var_direct = false;
+	if_data.tx_msg.var_crc = false;
+	if_data.tx_msg.tagged = false;
+	if_data.tx_error_count = 0;
+	if_data.tx_error_flag = false;
+	
+	if_data.rx_state = IF_RX_STATE_WAIT;
+	if_data.rx_error_count = 0;
+	if_data.rx_error_flag = false;
+	if_data.rx_head = 0;
+	if_data.rx_tail = 0;
+	
+	memset(&(if_data.rx_msg), 0, sizeof(if_data.rx_msg));
+	
+	if_data.wait_trigger = false;
+	if_data.wait_measure = false;
+	if_data.trigger_tagged = false;
+	if_data.measure_tagged = false;
+	if_data.event_triggers = 0;
+	if_data.event_frames = 0;
+	if_data.event_dropped = 0;
+	if_data.tx_frame = NULL;
+	
+	if_data.h_spi_fpga = DRV_HANDLE_INVALID;
+	if_data.h_spi_afe = DRV_HANDLE_INVALID;
+	if_data.h_i2c_dac = DRV_HANDLE_INVALID;
+}
+
+void
+if_task (void)
+{
+	const if_msg_desc_t * desc;
+	uint32_t events;
+	
+	// Commands are taken in while earlier ones are answered
+	if (IF_STATE_INIT != if_data.state)
+	{
+		if_rx_task();
+	}
+	
+	switch (if_data.state)
+	{
+		case IF_STATE_INIT:
+			if_data.state = IF_STATE_WAIT;
+			
+			// init fpga spi
+			if (DRV_HANDLE_INVALID == if_data.h_spi_fpga)
+			{
+				if_data.h_spi_fpga =
+					DRV_SPI_Open(DRV_SPI_INDEX_0, DRV_IO_INTENT_EXCLUSIVE);
+			}
+			if (DRV_HANDLE_INVALID == if_data.h_spi_fpga)
+			{
+				if_data.state = IF_STATE_INIT;
+			}
+			else
+			{
+				// bare minimum configuration for now
+			}
+			
+			// init afe (filter/pga) spi
+			if (DRV_HANDLE_INVALID == if_data.h_spi_afe)
+			{
+				if_data.h_spi_afe =
+					DRV_SPI_Open(DRV_SPI_INDEX_1, DRV_IO_INTENT_EXCLUSIVE);
+			}
+			if (DRV_HANDLE_INVALID == if_data.h_spi_afe)
+			{
+				if_data.state = IF_STATE_INIT;
+			}
+			else
+			{
+				// bare minimum configuration for now
+			}
+			
+			// init dac i2c
+			if (DRV_HANDLE_INVALID == if_data.h_i2c_dac)
+			{
+				if_data.h_i2c_dac =
+					DRV_I2C_Open(DRV_I2C_INDEX_0, DRV_IO_INTENT_EXCLUSIVE);
+			}
+			if (DRV_HANDLE_INVALID == if_data.h_i2c_dac)
+			{
+				if_data.state = IF_STATE_INIT;
+			}
+			else
+			{
+				// bare minimum configuration for now
+			}
+			
+			break;
+		
+		case IF_STATE_WAIT:
+			if (!gp_comms->isConfigured)
+			{
+				// A new session starts escaped, old hosts know no other
+				if_data.framing = IF_FRAMING_ESCAPED;
+				if_data.framing_next = IF_FRAMING_ESCAPED;
+				
+				// and hears of nothing from before it
+				if_event_seen(IF_EVENTS);
+			}
+			
+			if (if_data.rx_head != if_data.rx_tail)
+			{
+				if_data.rx_msg = if_data.rx_queue[
+					if_data.rx_tail % IF_RX_QUEUE].msg;
+				if_data.state = IF_STATE_PROCESS_HOST_MSG;
+			}
+			
+			// Then events, they are small and the host is waiting on them.
+			// Those it did not ask for are not held back for later.
+			events = if_event_changes();
+			if_event_seen(events & ~appData.regs.notify);
+			if (IF_STATE_WAIT == if_data.state
+				&& (events & appData.regs.notify))
+			{
+				if_send_event(events & appData.regs.notify);
+				if_data.state = IF_STATE_SEND_HW_MSG;
+			}
+			
+			// Host messages go first, a stream must not starve them
+			if (IF_STATE_WAIT == if_data.state
+				&& (if_data.wait_trigger || if_data.wait_measure
+				|| APP_Streaming()))
+			{
+				if_data.tx_frame = APP_FrameAcquire();
+				if (NULL == if_data.tx_frame)
+				{
+					// nothing captured yet
+				}
+				else if (if_data.tx_frame->stream)
+				{
+					if_send_stream_data();
+					if_data.state = IF_STATE_SEND_HW_MSG;
+				}
+				else if (if_data.wait_measure)
+				{
+					if_send_measure();
+					if_data.wait_measure = false;
+					if_data.state = IF_STATE_SEND_HW_MSG;
+				}
+				else
+				{
+					if_send_samp_data();
+					if_data.wait_trigger = false;
+					if_data.state = IF_STATE_SEND_HW_MSG;
+				}
+			}
+			break;
+		
+		case IF_STATE_PROCESS_HOST_MSG:
+			// An answer goes out under the tag of its command
+			if_data.tx_msg.tagged = if_data.rx_msg.tagged;
+			if_data.tx_msg.tag = if_data.rx_msg.tag;
+			
+			// Only commands with a descriptor make it into the queue
+			desc = if_msg_desc(IF_MSG_COMMAND, if_data.rx_msg.command,
+				false);
+			if (NULL != desc && NULL != desc->handler)
+			{
+				desc->handler();
+			}
+			
+			// Its slot may take the next command now
+			if_data.rx_tail++;
+			if_data.state = IF_STATE_SEND_HW_MSG;
+			break;
+		
+		case IF_STATE_SEND_HW_MSG:
+			if (IF_TX_STATE_WAIT == if_data.tx_state)
+			{
+				if_data.state = IF_STATE_WAIT;
+			}
+			else
+			{
+				if_tx_task();
+			}
+			break;
+		
+		default:
+			if_data.state = IF_STATE_INIT;
+			break;
+	}
+}
+
+bool
+if_idle (void)
+{
+	// Nothing to do until the host sends more or the app hands over a frame
+	return IF_STATE_WAIT == if_data.state
+		&& IF_TX_STATE_WAIT == if_data.tx_state
+		&& IF_RX_STATE_RECEIVING == if_data.rx_state
+		&& if_data.rx_head == if_data.rx_tail
+		&& 0 == (if_event_changes() & appData.regs.notify);
+}
+
+
+static const if_msg_desc_t *
+if_msg_desc (if_msg_type_t type, uint8_t command, bool outgoing)
+{
+	// A command coming in is one the host sends, going out a notice
+	unsigned int i = (unsigned int) command - IF_CMD_BASE;
+	const if_msg_desc_t * desc;
+	
+	if (i >= IF_CMD_SPAN)
+	{
+		return NULL;
+	}
+	
+	switch (type)
+	{
+		case IF_MSG_COMMAND:
+			desc = outgoing ? &(if_notice_desc[i]) : &(if_command_desc[i]);
+			break;
+		
+		case IF_MSG_RESULT:
+			desc = &(if_result_desc[i]);
+			break;
+		
+		default:
+			return NULL;
+	}
+	return desc->known ? desc : NULL;
+}
+
+static int
+if_msg_data_len (const if_msg_desc_t * desc, const if_message_t * msg)
+{
+	if (IF_LEN_OWN != desc->data_length)
+	{
+		return desc->data_length;
+	}
+	
+	// Sample data, the field after the length says which kind
+	switch (msg->data.res_data_mixed.logic_data_length_fi)
+	{
+		case LOGIC_DATA_LENGTH_FI:
+		case PEAK_RECORD_LENGTH_FI:
+		case AVERAGE_COUNT_FI:
+		case AVERAGE16_COUNT_FI:
+		case SAMPLE_CODEC_FI:
+		case SPECTRUM_LENGTH_FI:
+		case SPECTRUM_LOG_FI:
+			return sizeof(if_res_data_mixed_t);
+		
+		default:
+			return sizeof(if_res_data_req_samp_data_t);
+	}
+}
+
+static int
+if_msg_var_len (const if_msg_desc_t * desc, const if_message_t * msg)
+{
+	uint32_t length;
+	
+	if (IF_VAR_NONE == desc->var_offset)
+	{
+		return 0;
+	}
+	
+	if (IF_VAR_OWN != desc->var_offset)
+	{
+		memcpy(&length, &(((const uint8_t *) &(msg->data))[desc->var_offset]),
+			sizeof(length));
+		return (int) length;
+	}
+	
+	switch (msg->command)
+	{
+		case IF_CMD_REQ_SAMP_DATA:
+			length = msg->data.res_data_req_samp_data.sample_data_length;
+			if (LOGIC_DATA_LENGTH_FI
+				== msg->data.res_data_mixed.logic_data_length_fi)
+			{
+				length += msg->data.res_data_mixed.logic_data_length;
+			}
+			return (int) length;
+		
+		case IF_CMD_SEGMENTS:
+			return msg->data.res_data_segments.segment_count
+				* (sizeof(uint64_t)
+				+ msg->data.res_data_segments.segment_length);
+		
+		case IF_CMD_MEASURE:
+			return sizeof(measure_result_t);
+		
+		default:
+			return -1;
+	}
+}
+
+static void
+if_rx_task (void)
+{
+	// Commands are decoded into rx_queue as they come, the host need not
+	// wait for answers until it is full
+	const if_msg_desc_t * desc;
+	if_message_t * msg;
+	unsigned int length;
+	unsigned int i, o;
+	int data_len, var_data_len;
+	
+	switch (if_data.rx_state)
+	{
+		case IF_RX_STATE_WAIT:
+			if (if_data.rx_head - if_data.rx_tail < IF_RX_QUEUE
+				&& true == comms_receive_auto(gp_comms, in_buffer,
+				MAX_INCOMING_MESSAGE, IF_END_MESSAGE))
+			{
+				if_data.rx_state = IF_RX_STATE_RECEIVING;
+			}
+			break;
+		
+		case IF_RX_STATE_RECEIVING:
+			if (!gp_comms->rx_auto)
+			{
+				if (gp_comms->rx_auto_fail)
+				{
+					if_data.rx_error_count++;
+					if_data.rx_error_flag = true;
+					if_data.rx_state = IF_RX_STATE_WAIT;
+				}
+				else
+				{
+					if_data.rx_state = IF_RX_STATE_DECODE;
+				}
+			}
+			break;
+		
+		case IF_RX_STATE_DECODE:
+			if_data.rx_state = IF_RX_STATE_WAIT;
+			
+			// Unescape in place, what is left is the message as it is
+			for (i = 0, o = 0; i < gp_comms->receiveBytesTotal; i++, o++)
+			{
+				if (IF_ESCAPE == in_buffer[i]
+					&& i + 1 < gp_comms->receiveBytesTotal)
+				{
+					i++;
+				}
+				in_buffer[o] = in_buffer[i];
+			}
+			length = o;
+			
+			msg = &(if_data.rx_queue[if_data.rx_head % IF_RX_QUEUE].msg);
+			o = 0;
+			
+			if (length < 4 || in_buffer[o++] != IF_START_MESSAGE)
+			{
+				if_data.rx_error_count++;
+				if_data.rx_error_flag = true;
+				break;
+			}
+			
+			msg->type = in_buffer[o++];
+			msg->tagged = IF_MSG_COMMAND_TAGGED == msg->type;
+			if (IF_MSG_COMMAND != msg->type && !msg->tagged)
+			{
+				if_data.rx_error_count++;
+				if_data.rx_error_flag = true;
+				break;
+			}
+			msg->type = IF_MSG_COMMAND;
+			msg->command = in_buffer[o++];
+			msg->tag = msg->tagged ? in_buffer[o++] : 0;
+			
+			desc = if_msg_desc(msg->type, msg->command, false);
+			if (NULL == desc)
+			{
+				if_data.rx_error_count++;
+				if_data.rx_error_flag = true;
+				break;
+			}
+			
+			data_len = if_msg_data_len(desc, msg);
+			if (o + data_len > length)
+			{
+				if_data.rx_error_count++;
+				if_data.rx_error_flag = true;
+				break;
+			}
+			
+			memcpy(&(msg->data), &(in_buffer[o]), data_len);
+			o += data_len;
+			
+			var_data_len = if_msg_var_len(desc, msg);
+			if (var_data_len < 0 || var_data_len > IF_RX_VAR_MAX
+				|| o + var_data_len > length)
+			{
+				if_data.rx_error_count++;
+				if_data.rx_error_flag = true;
+				break; 
+			}
+			
+			msg->var_data = if_data.rx_queue[
+				if_data.rx_head % IF_RX_QUEUE].var;
+			memcpy(msg->var_data, &(in_buffer[o]), var_data_len);
+			msg->length = var_data_len;
+			
+			if_data.rx_head++;
+			break;
+		
+		default:
+			break;
+	}
+}
+
+unsigned int
+if_escape (uint8_t * out, const uint8_t * in, unsigned int length)
+{
+	// Copy in to out with the framing bytes escaped, returns bytes written.
+	// The framing bytes are all below IF_ESCAPE_BELOW, and a word without
+	// such a byte is found with a subtract and two masks. Runs of those go
+	// four bytes a step and are copied in one go, only the bytes of words
+	// that may hold one are looked up.
+	unsigned int i = 0;
+	unsigned int o = 0;
+	
+	while (i < length)
+	{
+		unsigned int run = i;
+		
+		for (;;)
+		{
+			if (0 == ((uintptr_t) &(in[run]) & 3U))
+			{
+				while (run + 4U <= length)
+				{
+					uint32_t w = *(const uint32_t *) &(in[run]);
+					
+					if ((w - 0x01010101U * IF_ESCAPE_BELOW) & ~w & 0x80808080U)
+					{
+						break;
+					}
+					run += 4U;
+				}
+			}
+			if (run >= length || if_escape_class[in[run]])
+			{
+				break;
+			}
+			run++;
+		}
+		
+		memcpy(&(out[o]), &(in[i]), run - i);
+		o += run - i;
+		i = run;
+		
+		if (i < length)
+		{
+			out[o++] = IF_ESCAPE;
+			out[o++] = in[i++];
+		}
+	}
+	return o;
+}
+
+static unsigned int
+if_tx_escape_into (uint8_t * out, unsigned int room, const uint8_t * in,
+	unsigned int length, unsigned int * used)
+{
+	// if_escape() as much of in as fits in room. Half the room left is
+	// always safe, so it goes in steps that halve. With one byte left an
+	// escaped byte is split, its second half held for the next packet.
+	unsigned int i = 0;
+	unsigned int o = 0;
+	
+	while (i < length && o < room)
+	{
+		unsigned int n = (room - o) / 2U;
+		
+		if (n > length - i)
+		{
+			n = length - i;
+		}
+		
+		if (n)
+		{
+			o += if_escape(&(out[o]), &(in[i]), n);
+			i += n;
+		}
+		else if (if_escape_class[in[i]])
+		{
+			out[o++] = IF_ESCAPE;
+			if_data.tx_held = true;
+			if_data.tx_held_byte = in[i++];
+		}
+		else
+		{
+			out[o++] = in[i++];
+		}
+	}
+	
+	*used = i;
+	return o;
+}
+
+static bool
+if_tx_next_span (void)
+{
+	// Point tx_span at the next run of variable data, coded into
+	// codec_buffer on the way if asked. Data in two pieces is read straight
+	// from both, a span stops at the seam. False once all of it is taken.
+	unsigned int n = if_data.tx_var_length - if_data.tx_var_offset;
+	unsigned int wrap_at = if_data.tx_msg.var_wrap_at;
+	unsigned char * src = &(if_data.tx_msg.var_data[if_data.tx_var_offset]);
+	
+	if (0 == n)
+	{
+		return false;
+	}
+	
+	if (wrap_at && if_data.tx_var_offset >= wrap_at)
+	{
+		src = &(if_data.tx_msg.var_wrap[if_data.tx_var_offset - wrap_at]);
+	}
+	else if (wrap_at && n > wrap_at - if_data.tx_var_offset)
+	{
+		n = wrap_at - if_data.tx_var_offset;
+	}
+	
+	if (CODEC_NONE != if_data.tx_msg.var_codec)
+	{
+		// Coded as it goes, until codec_buffer is full
+		uint32_t t0 = CORETIMER_CounterGet();
+		uint32_t used;
+		uint32_t coded = codec_encode(&(if_data.tx_codec), src, n, &used,
+			codec_buffer, sizeof(codec_buffer) - CODEC_FLUSH_MAX);
+		
+		if (if_data.tx_var_offset + used >= if_data.tx_var_length)
+		{
+			coded += codec_flush(&(if_data.tx_codec), &(codec_buffer[coded]));
+		}
+		if_data.tx_codec_ticks += CORETIMER_CounterGet() - t0;
+		if_data.tx_coded += coded;
+		
+		if_data.tx_span = codec_buffer;
+		if_data.tx_span_length = coded;
+		if_data.tx_var_offset += used;
+	}
+	else
+	{
+		if_data.tx_span = src;
+		if_data.tx_span_length = n;
+		if_data.tx_var_offset += n;
+	}
+	return true;
+}
+
+static void
+if_tx_var_done (void)
+{
+	// All variable data is put into out_buffer or queued in place
+	if_data.tx_msg.var_wrap_at = 0;
+	
+	if (CODEC_NONE != if_data.tx_msg.var_codec && if_data.tx_var_length)
+	{
+		appData.stats.codec_ratio = (uint32_t) (((uint64_t)
+			if_data.tx_coded * 1000U) / if_data.tx_var_length);
+		appData.stats.codec_cost = (uint32_t) (((uint64_t)
+			if_data.tx_codec_ticks * 1000U) / if_data.tx_var_length);
+	}
+	if_data.tx_msg.var_codec = CODEC_NONE;
+	if_data.tx_msg.var_direct = false;
+	
+	// The frame is copied out, acquisition may reuse it. Going out in place
+	// it waits for the bus, see IF_TX_STATE_DRAIN.
+	if (NULL != if_data.tx_frame && !if_data.tx_direct)
+	{
+		APP_FrameRelease(if_data.tx_frame);
+		if_data.tx_frame = NULL;
+	}
+}
+
+static unsigned int
+if_tx_put (uint8_t * out, unsigned int room, const uint8_t * in,
+	unsigned int length, unsigned int * used)
+{
+	// As much of in as fits in room, in the framing of the message
+	unsigned int n = (length < room) ? length : room;
+	
+	if (IF_FRAMING_ESCAPED == if_data.tx_framing)
+	{
+		return if_tx_escape_into(out, room, in, length, used);
+	}
+	
+	memcpy(out, in, n);
+	*used = n;
+	return n;
+}
+
+static unsigned int
+if_tx_fill (uint8_t * out, unsigned int o)
+{
+	// Put the message from where the last packet stopped into out, after
+	// the o bytes already there. Returns the bytes in out, IF_TX_PACKET
+	// unless the message ended or the variable data goes in place. Parts
+	// with nothing to put are passed right away, so tx_part is
+	// IF_TX_PART_DONE as soon as the last byte is in.
+	unsigned int used;
+	
+	if (if_data.tx_held)
+	{
+		out[o++] = if_data.tx_held_byte;
+		if_data.tx_held = false;
+	}
+	
+	while (IF_TX_PART_DONE != if_data.tx_part)
+	{
+		switch (if_data.tx_part)
+		{
+			case IF_TX_PART_DATA:
+				if (if_data.tx_data_offset >= if_data.tx_data_length)
+				{
+					if_data.tx_part = IF_TX_PART_VAR;
+					break;
+				}
+				if (o >= IF_TX_PACKET)
+				{
+					return o;
+				}
+				
+				o += if_tx_put(&(out[o]), IF_TX_PACKET - o,
+					&(if_data.tx_msg.data.bytes[if_data.tx_data_offset]),
+					if_data.tx_data_length - if_data.tx_data_offset, &used);
+				if_data.tx_data_offset += used;
+				break;
+			
+			case IF_TX_PART_VAR:
+				if (0 == if_data.tx_span_length)
+				{
+					if (!if_tx_next_span())
+					{
+						if_tx_var_done();
+						if_data.tx_part = IF_TX_PART_CRC;
+					}
+					break;
+				}
+				if (o >= IF_TX_PACKET || if_data.tx_direct)
+				{
+					return o;
+				}
+				
+				o += if_tx_put(&(out[o]), IF_TX_PACKET - o,
+					if_data.tx_span, if_data.tx_span_length, &used);
+				if_data.tx_span += used;
+				if_data.tx_span_length -= used;
+				break;
+			
+			case IF_TX_PART_CRC:
+				if (if_data.tx_msg.var_crc)
+				{
+					uint32_t t0 = CORETIMER_CounterGet();
+					uint32_t crc;
+					bool ready = crc_result(&crc);
+					
+					if_data.tx_crc_ticks += CORETIMER_CounterGet() - t0;
+					if (!ready)
+					{
+						// the engine is still reading, rarely
+						return o;
+					}
+					
+					if_data.tx_trailer[0] = (uint8_t) crc;
+					if_data.tx_trailer[1] = (uint8_t) (crc >> 8);
+					if_data.tx_trailer[2] = (uint8_t) (crc >> 16);
+					if_data.tx_trailer[3] = (uint8_t) (crc >> 24);
+					if_data.tx_trailer_length = sizeof(if_data.tx_trailer);
+					if_data.tx_msg.var_crc = false;
+					appData.stats.crc_ticks = if_data.tx_crc_ticks;
+				}
+				
+				if (if_data.tx_trailer_offset >= if_data.tx_trailer_length)
+				{
+					if_data.tx_part = IF_TX_PART_END;
+					break;
+				}
+				if (o >= IF_TX_PACKET)
+				{
+					return o;
+				}
+				
+				o += if_tx_put(&(out[o]), IF_TX_PACKET - o,
+					&(if_data.tx_trailer[if_data.tx_trailer_offset]),
+					if_data.tx_trailer_length - if_data.tx_trailer_offset,
+					&used);
+				if_data.tx_trailer_offset += used;
+				break;
+			
+			case IF_TX_PART_END:
+			default:
+				if (IF_FRAMING_ESCAPED == if_data.tx_framing)
+				{
+					if (o >= IF_TX_PACKET)
+					{
+						return o;
+					}
+					out[o++] = IF_END_MESSAGE;
+				}
+				if_data.tx_part = IF_TX_PART_DONE;
+				break;
+		}
+	}
+	return o;
+}
+
+static void
+if_tx_task (void)
+{
+	// A packet is put into one out_buffer while the last one goes out of
+	// the other. All but the last packet of a message are full and tell
+	// the host more is coming. Under IF_FRAMING_LENGTH a record bigger than
+	// a packet goes out of the frame in place, behind a packet with the
+	// header.
+	const if_msg_desc_t * desc;
+	uint8_t * out = out_buffer[if_data.tx_buffer];
+	unsigned int o = 0;
+	bool more;
+	
+	switch (if_data.tx_state)
+	{
+		case IF_TX_STATE_ENCODE:
+		case IF_TX_STATE_ENCODE_NEXT:
+			if (comms_transmit_pending(gp_comms) >= IF_TX_BUFFERS)
+			{
+				// this buffer is still going out
+				break;
+			}
+			
+			if (IF_TX_STATE_ENCODE == if_data.tx_state)
+			{
+				if_data.tx_framing = if_data.framing;
+				if_data.tx_direct = false;
+				
+				out[o++] = IF_START_MESSAGE;
+				if (if_data.tx_msg.tagged)
+				{
+					out[o++] = (IF_MSG_RESULT == if_data.tx_msg.type)
+						? IF_MSG_RESULT_TAGGED : IF_MSG_COMMAND_TAGGED;
+					out[o++] = if_data.tx_msg.command;
+					if (IF_FRAMING_ESCAPED == if_data.tx_framing)
+					{
+						o += if_escape(&(out[o]), &(if_data.tx_msg.tag), 1);
+					}
+					else
+					{
+						out[o++] = if_data.tx_msg.tag;
+					}
+				}
+				else
+				{
+					out[o++] = if_data.tx_msg.type;
+					out[o++] = if_data.tx_msg.command;
+				}
+				
+				if_data.tx_part = IF_TX_PART_DATA;
+				if_data.tx_data_offset = 0;
+				desc = if_msg_desc(if_data.tx_msg.type,
+					if_data.tx_msg.command, true);
+				if_data.tx_data_length = if_msg_data_len(desc,
+					&(if_data.tx_msg));
+				if_data.tx_span_length = 0;
+				if_data.tx_held = false;
+				if_data.tx_var_offset = 0;
+				if_data.tx_var_length = if_msg_var_len(desc,
+					&(if_data.tx_msg));
+				codec_init(&(if_data.tx_codec));
+				if_data.tx_coded = 0;
+				if_data.tx_codec_ticks = 0;
+				if_data.tx_trailer_offset = 0;
+				if_data.tx_trailer_length = 0;
+				
+				if (if_data.tx_msg.var_crc)
+				{
+					// Started now, the engine reads ahead of the encoder
+					uint32_t t0 = CORETIMER_CounterGet();
+					unsigned int wrap_at = if_data.tx_msg.var_wrap_at;
+					
+					crc_start(if_data.tx_msg.var_data,
+						wrap_at ? wrap_at : if_data.tx_var_length,
+						if_data.tx_msg.var_wrap,
+						wrap_at ? if_data.tx_var_length - wrap_at : 0,
+						if_data.tx_msg.var_direct);
+					if_data.tx_crc_ticks = CORETIMER_CounterGet() - t0;
+				}
+				
+				if (IF_FRAMING_LENGTH == if_data.tx_framing)
+				{
+					uint32_t length = if_data.tx_data_length
+						+ if_data.tx_var_length
+						+ (if_data.tx_msg.var_crc ? 4U : 0U);
+					
+					out[o++] = (uint8_t) length;
+					out[o++] = (uint8_t) (length >> 8);
+					out[o++] = (uint8_t) (length >> 16);
+					out[o++] = (uint8_t) (length >> 24);
+					
+					if_data.tx_direct = if_data.tx_msg.var_direct
+						&& o + length > IF_TX_PACKET;
+				}
+			}
+			
+			if (if_data.tx_direct && IF_TX_PART_VAR == if_data.tx_part
+				&& if_data.tx_span_length)
+			{
+				// Straight out of the frame, the rest follows if it wraps
+				if_data.tx_out = (uint8_t *) if_data.tx_span;
+				if_data.tx_msg.length = if_data.tx_span_length;
+				if_data.tx_span_length = 0;
+				
+				if (if_data.tx_var_offset >= if_data.tx_var_length)
+				{
+					// Nothing goes after the data under this framing but
+					// the CRC
+					if_tx_var_done();
+					if_data.tx_part = if_data.tx_msg.var_crc
+						? IF_TX_PART_CRC : IF_TX_PART_DONE;
+				}
+			}
+			else
+			{
+				if_data.tx_out = out;
+				if_data.tx_msg.length = if_tx_fill(out, o);
+			}
+			
+			if (0 == if_data.tx_msg.length)
+			{
+				// waiting on the CRC, nothing to send yet
+				if_data.tx_state = IF_TX_STATE_ENCODE_NEXT;
+				break;
+			}
+			if_data.tx_state = IF_TX_STATE_TRANSMIT;
+		
+		case IF_TX_STATE_TRANSMIT:
+			// Writes that are not whole packets end a transfer, the host
+			// sees the same bytes either way
+			more = IF_TX_PART_DONE != if_data.tx_part;
+			if (!comms_transmit(gp_comms, if_data.tx_out,
+				if_data.tx_msg.length,
+				more && 0 == if_data.tx_msg.length % IF_TX_PACKET))
+			{
+				// the driver took no more, try again next pass
+				break;
+			}
+			
+			if (if_data.tx_out == out)
+			{
+				if_data.tx_buffer = (if_data.tx_buffer + 1U) % IF_TX_BUFFERS;
+			}
+			
+			if (more)
+			{
+				if_data.tx_state = IF_TX_STATE_ENCODE_NEXT;
+			}
+			else
+			{
+				// A new framing starts with the next message
+				if_data.framing = if_data.framing_next;
+				if_data.tx_state = if_data.tx_direct
+					? IF_TX_STATE_DRAIN : IF_TX_STATE_WAIT;
+			}
+			break;
+		
+		case IF_TX_STATE_DRAIN:
+			// The frame went out in place, it is free once the bus is done
+			if (0 == comms_transmit_pending(gp_comms))
+			{
+				if (NULL != if_data.tx_frame)
+				{
+					APP_FrameRelease(if_data.tx_frame);
+					if_data.tx_frame = NULL;
+				}
+				if_data.tx_direct = false;
+				if_data.tx_state = IF_TX_STATE_WAIT;
+			}
+			break;
+		
+		case IF_TX_STATE_WAIT:
+		default:
+			break;
+	}
+}
+
+static void
+if_send_samp_data (void)
+{
+	if_data.tx_msg.type = IF_MSG_RESULT;
+	if_data.tx_msg.tagged = if_data.trigger_tagged;
+	if_data.tx_msg.tag = if_data.trigger_tag;
+	if_data.tx_msg.var_data = if_data.tx_frame->first;
+	if_data.tx_msg.var_direct = true;
+	if_data.tx_msg.var_crc = 0U != appData.regs.crc;
+	
+	if (if_data.tx_frame->segments)
+	{
+		// Segmented frame, everything goes out as one batch
+		if_data.tx_msg.command = IF_CMD_SEGMENTS;
+		if_data.tx_msg.data.res_data_segments.segment_count_fi =
+			SEGMENT_COUNT_FI;
+		if_data.tx_msg.data.res_data_segments.segment_count =
+			if_data.tx_frame->segments;
+		if_data.tx_msg.data.res_data_segments.segment_length_fi =
+			SEGMENT_LENGTH_FI;
+		if_data.tx_msg.data.res_data_segments.segment_length =
+			if_data.tx_frame->segment_length;
+		if_data.tx_msg.data.res_data_segments.segment_stamps_fi =
+			SEGMENT_STAMPS_FI;
+	}
+	else
+	{
+		if_data.tx_msg.command = IF_CMD_REQ_SAMP_DATA;
+		if_data.tx_msg.data.res_data_req_samp_data.sample_data_fi =
+			SAMPLE_DATA_FI;
+		if_data.tx_msg.data.res_data_req_samp_data.sample_data_length_fi =
+			SAMPLE_DATA_LENGTH_FI;
+		if_data.tx_msg.data.res_data_req_samp_data.sample_data_length =
+			if_data.tx_frame->last - if_data.tx_frame->first;
+		
+		if (if_data.tx_frame->logic_length)
+		{
+			// Samples, then the bit planes right behind them
+			if_data.tx_msg.data.res_data_mixed.sample_data_length =
+				(if_data.tx_frame->last - if_data.tx_frame->first)
+				- if_data.tx_frame->logic_length;
+			if_data.tx_msg.data.res_data_mixed.logic_data_length_fi =
+				LOGIC_DATA_LENGTH_FI;
+			if_data.tx_msg.data.res_data_mixed.logic_data_length =
+				if_data.tx_frame->logic_length;
+			if_data.tx_msg.data.res_data_mixed.sample_data_fi =
+				SAMPLE_DATA_FI;
+		}
+		else if (if_data.tx_frame->peak_length)
+		{
+			// Min/max pairs, the record length they stand for goes along
+			if_data.tx_msg.data.res_data_peak.peak_record_length_fi =
+				PEAK_RECORD_LENGTH_FI;
+			if_data.tx_msg.data.res_data_peak.peak_record_length =
+				if_data.tx_frame->peak_length;
+			if_data.tx_msg.data.res_data_peak.sample_data_fi = SAMPLE_DATA_FI;
+		}
+		else if (if_data.tx_frame->spectrum_length)
+		{
+			if_data.tx_msg.data.res_data_spectrum.spectrum_length_fi =
+				(16U == if_data.tx_frame->sample_bits)
+				? SPECTRUM_LENGTH_FI : SPECTRUM_LOG_FI;
+			if_data.tx_msg.data.res_data_spectrum.spectrum_length =
+				if_data.tx_frame->spectrum_length;
+			if_data.tx_msg.data.res_data_spectrum.sample_data_fi =
+				SAMPLE_DATA_FI;
+		}
+		else if (if_data.tx_frame->averages)
+		{
+			if_data.tx_msg.data.res_data_average.average_count_fi =
+				(16U == if_data.tx_frame->sample_bits)
+				? AVERAGE16_COUNT_FI : AVERAGE_COUNT_FI;
+			if_data.tx_msg.data.res_data_average.average_count =
+				if_data.tx_frame->averages;
+			if_data.tx_msg.data.res_data_average.sample_data_fi =
+				SAMPLE_DATA_FI;
+		}
+		else if (if_data.tx_frame->wrap)
+		{
+			// Pre-trigger record, oldest sample first: first..end then
+			// data..last, no copy to straighten it out
+			if_data.tx_msg.var_wrap = if_data.tx_frame->data;
+			if_data.tx_msg.var_wrap_at = if_data.tx_frame->wrap;
+			if_data.tx_msg.data.res_data_req_samp_data.sample_data_length =
+				if_data.tx_frame->wrap
+				+ (if_data.tx_frame->last - if_data.tx_frame->data);
+		}
+		
+		// Coding is against escapes, length framing goes in place instead
+		if (CODEC_NONE != appData.regs.compression
+			&& IF_FRAMING_ESCAPED == if_data.framing
+			&& 0 == if_data.tx_frame->logic_length
+			&& 0 == if_data.tx_frame->peak_length
+			&& 0 == if_data.tx_frame->spectrum_length
+			&& 0 == if_data.tx_frame->averages)
+		{
+			// Plain samples go out coded, the length stays in samples
+			if_data.tx_msg.data.res_data_coded.sample_codec_fi =
+				SAMPLE_CODEC_FI;
+			if_data.tx_msg.data.res_data_coded.sample_codec =
+				appData.regs.compression;
+			if_data.tx_msg.data.res_data_coded.sample_data_fi =
+				SAMPLE_DATA_FI;
+			if_data.tx_msg.var_codec = (uint8_t) appData.regs.compression;
+		}
+	}
+	
+	if_data.tx_state = IF_TX_STATE_ENCODE;
+}
+
+static void
+if_send_measure (void)
+{
+	// Only the results go out, the frame is released after them
+	if_data.tx_msg.type = IF_MSG_RESULT;
+	if_data.tx_msg.command = IF_CMD_MEASURE;
+	if_data.tx_msg.tagged = if_data.measure_tagged;
+	if_data.tx_msg.tag = if_data.measure_tag;
+	if_data.tx_msg.var_data = (unsigned char *) &(if_data.tx_frame->measure);
+	
+	if_data.tx_msg.data.res_data_measure.frame_seq_fi = MEASURE_SEQ_FI;
+	if_data.tx_msg.data.res_data_measure.frame_seq = if_data.tx_frame->seq;
+	if_data.tx_msg.data.res_data_measure.measure_data_fi = MEASURE_DATA_FI;
+	
+	if_data.tx_state = IF_TX_STATE_ENCODE;
+}
+
+static void
+if_send_stream_data (void)
+{
+	if_data.tx_msg.type = IF_MSG_COMMAND;
+	if_data.tx_msg.command = IF_CMD_STREAM_DATA;
+	if_data.tx_msg.tagged = false;
+	
+	if_data.tx_msg.data.cmd_data_stream_data.stream_seq_fi = STREAM_SEQ_FI;
+	if_data.tx_msg.data.cmd_data_stream_data.stream_seq =
+		if_data.tx_frame->seq;
+	if_data.tx_msg.data.cmd_data_stream_data.stream_length_fi =
+		STREAM_LENGTH_FI;
+	if_data.tx_msg.data.cmd_data_stream_data.stream_length =
+		if_data.tx_frame->last - if_data.tx_frame->first;
+	if_data.tx_msg.data.cmd_data_stream_data.stream_data_fi = STREAM_DATA_FI;
+	
+	if_data.tx_msg.var_data = if_data.tx_frame->first;
+	if_data.tx_msg.var_direct = true;
+	if_data.tx_msg.var_crc = 0U != appData.regs.crc;
+	
+	if_data.tx_state = IF_TX_STATE_ENCODE;
+}
+
+static uint32_t
+if_event_changes (void)
+{
+	// IF_EVENT_* whose counts moved since they were last sent
+	uint32_t events = 0;
+	
+	if (appData.stats.trig_count != if_data.event_triggers)
+	{
+		events |= IF_EVENT_TRIGGER;
+	}
+	if (appData.seq != if_data.event_frames)
+	{
+		events |= IF_EVENT_FRAME;
+	}
+	if (appData.stats.frames_dropped != if_data.event_dropped)
+	{
+		events |= IF_EVENT_OVERFLOW;
+	}
+	return events;
+}
+
+static void
+if_event_seen (uint32_t events)
+{
+	if (events & IF_EVENT_TRIGGER)
+	{
+		if_data.event_triggers = appData.stats.trig_count;
+	}
+	if (events & IF_EVENT_FRAME)
+	{
+		if_data.event_frames = appData.seq;
+	}
+	if (events & IF_EVENT_OVERFLOW)
+	{
+		if_data.event_dropped = appData.stats.frames_dropped;
+	}
+}
+
+static void
+if_send_event (uint32_t events)
+{
+	// Untagged, no command asked for it
+	if_data.tx_msg.type = IF_MSG_COMMAND;
+	if_data.tx_msg.command = IF_CMD_EVENT;
+	if_data.tx_msg.tagged = false;
+	
+	if_event_seen(events);
+	if_data.tx_msg.data.cmd_data_event.event_fi = EVENT_FI;
+	if_data.tx_msg.data.cmd_data_event.events = events;
+	if_data.tx_msg.data.cmd_data_event.event_triggers_fi = EVENT_TRIGGERS_FI;
+	if_data.tx_msg.data.cmd_data_event.event_triggers =
+		appData.stats.trig_count;
+	if_data.tx_msg.data.cmd_data_event.event_frames_fi = EVENT_FRAMES_FI;
+	if_data.tx_msg.data.cmd_data_event.event_frames = appData.seq;
+	if_data.tx_msg.data.cmd_data_event.event_dropped_fi = EVENT_DROPPED_FI;
+	if_data.tx_msg.data.cmd_data_event.event_dropped =
+		appData.stats.frames_dropped;
+	if_data.tx_state = IF_TX_STATE_ENCODE;
+}
+
+static void
+if_cmd_req_samp_data (void)
+{
+	// Answered with the next frame, under this tag
+	if_data.wait_trigger = true;
+	if_data.trigger_tagged = if_data.rx_msg.tagged;
+	if_data.trigger_tag = if_data.rx_msg.tag;
+}
+
+static void
+if_cmd_measure (void)
+{
+	if_data.wait_measure = true;
+	if_data.measure_tagged = if_data.rx_msg.tagged;
+	if_data.measure_tag = if_data.rx_msg.tag;
+}
+
+static void
+if_send_framing (void)
+{
+	// Takes effect once the answer is out, see if_tx_task()
+	uint32_t framing = if_data.rx_msg.data.cmd_data_framing.framing;
+	
+	if (FRAMING_FI == if_data.rx_msg.data.cmd_data_framing.framing_fi
+		&& framing < 32U && (IF_FRAMINGS & (1U << framing)))
+	{
+		if_data.framing_next = framing;
+	}
+	
+	if_data.tx_msg.type = IF_MSG_RESULT;
+	if_data.tx_msg.command = IF_CMD_FRAMING;
+	if_data.tx_msg.data.res_data_framing.framing_fi = FRAMING_FI;
+	if_data.tx_msg.data.res_data_framing.framing = if_data.framing_next;
+	if_data.tx_msg.data.res_data_framing.framings_fi = FRAMINGS_FI;
+	if_data.tx_msg.data.res_data_framing.framings = IF_FRAMINGS;
+	if_data.tx_state = IF_TX_STATE_ENCODE;
+}
+
+
+static void
+if_vm_dispatch (void)
+{
+	// Dispatch a read or write register command to the correct driver
+	
+	uint32_t address, length;
+	
+	if (IF_CMD_WRITE_REGS == if_data.rx_msg.command)
+	{
+		address = if_data.rx_msg.data.cmd_data_write_regs.write_address;
+		length  = if_data.rx_msg.data.cmd_data_write_regs.write_length;
+	}
+	else if (IF_CMD_READ_REGS == if_data.rx_msg.command)
+	{
+		address = if_data.rx_msg.data.cmd_data_read_regs.read_address;
+		length  = if_data.rx_msg.data.cmd_data_read_regs.read_length;
+	}
+	else
+	{
+		// Someone called this at the wrong time, do nothing
+		return;
+	}
+	
+	if (if_vm_in(address, length, IF_VM_PIC_START, IF_VM_PIC_END))
+	{
+		if_vm_pic_op(address - IF_VM_PIC_START, length);
+	}
+	else if (if_vm_in(address, length, IF_VM_FPGA_START, IF_VM_FPGA_END))
+	{
+		if_vm_fpga_op(address - IF_VM_FPGA_START, length);
+	}
+	else if (if_vm_in(address, length, IF_VM_AFE_START, IF_VM_AFE_END))
+	{
+		if_vm_afe_op(address - IF_VM_AFE_START, length);
+	}
+	else if (if_vm_in(address, length, IF_VM_DAC_START, IF_VM_DAC_END))
+	{
+		if_vm_dac_op(address - IF_VM_DAC_START, length);
+	}
+	else if (if_vm_in(address, length, IF_VM_STAT_START, IF_VM_STAT_END))
+	{
+		if_vm_stat_op(address - IF_VM_STAT_START, length);
+	}
+	else if (if_vm_in(address, length, IF_VM_HIST_START, IF_VM_HIST_END))
+	{
+		if_vm_hist_op(address - IF_VM_HIST_START, length);
+	}
+	else if (if_vm_in(address, length, IF_VM_MASK_START, IF_VM_MASK_END))
+	{
+		if_vm_mask_op(address - IF_VM_MASK_START, length);
+	}
+	else
+	{
+		// Invalid address and/or length
+		if_vm_respstp(0);
+	}
+}
+
+static bool
+if_vm_in (uint32_t address, uint32_t length, uint32_t start, uint32_t end)
+{
+	// The access lies in start..end. Nothing is added up, a length near
+	// 2^32 would wrap round past the end and pass.
+	return start <= address && address <= end
+		&& 0 != length && length <= end - address + 1U;
+}
+
+static void
+if_vm_vector (void)
+{
+	// Run each entry through if_vm_dispatch() as the command it names and
+	// gather what its answer would have been into one. The entries are
+	// in rx_msg's slot, which stays put until this returns.
+	const uint8_t * in = if_data.rx_msg.var_data;
+	unsigned int in_length = if_data.rx_msg.length;
+	uint32_t count = if_data.rx_msg.data.cmd_data_vector.vector_count;
+	unsigned int i = 0;
+	unsigned int o;
+	uint32_t n;
+	
+	if (VECTOR_COUNT_FI != if_data.rx_msg.data.cmd_data_vector.vector_count_fi
+		|| count > IF_VECTOR_OUT / sizeof(uint32_t))
+	{
+		count = 0;
+	}
+	memset(vm_vector_buf, 0, count * sizeof(uint32_t));
+	o = count * sizeof(uint32_t);
+	
+	for (n = 0; n < count; n++)
+	{
+		if_vector_op_t op;
+		uint32_t status = 0;
+		
+		if (i + sizeof(op) > in_length)
+		{
+			break;
+		}
+		memcpy(&op, &(in[i]), sizeof(op));
+		i += sizeof(op);
+		
+		if (IF_CMD_WRITE_REGS == op.command)
+		{
+			if (op.length > in_length - i)
+			{
+				break;
+			}
+			if_data.rx_msg.data.cmd_data_write_regs.write_address =
+				op.address;
+			if_data.rx_msg.data.cmd_data_write_regs.write_length =
+				op.length;
+			if_data.rx_msg.var_data = (unsigned char *) &(in[i]);
+			i += op.length;
+		}
+		else if (IF_CMD_READ_REGS == op.command
+			&& op.length <= IF_VECTOR_OUT - o)
+		{
+			if_data.rx_msg.data.cmd_data_read_regs.read_address =
+				op.address;
+			if_data.rx_msg.data.cmd_data_read_regs.read_length = op.length;
+		}
+		else
+		{
+			break;
+		}
+		
+		// Every access is answered, a refused one with length 0
+		if_data.rx_msg.command = op.command;
+		if_vm_dispatch();
+		
+		if (IF_CMD_WRITE_REGS == op.command)
+		{
+			status = if_data.tx_msg.data.res_data_write_regs.write_length;
+		}
+		else
+		{
+			status = if_data.tx_msg.data.res_data_read_regs.read_length;
+			if (status)
+			{
+				memcpy(&(vm_vector_buf[o]), if_data.tx_msg.var_data, status);
+				o += status;
+			}
+		}
+		memcpy(&(vm_vector_buf[n * sizeof(uint32_t)]), &status,
+			sizeof(status));
+	}
+	
+	if_data.rx_msg.command = IF_CMD_VECTOR;
+	
+	if_data.tx_msg.type = IF_MSG_RESULT;
+	if_data.tx_msg.command = IF_CMD_VECTOR;
+	if_data.tx_msg.data.res_data_vector.vector_count_fi = VECTOR_COUNT_FI;
+	if_data.tx_msg.data.res_data_vector.vector_count = count;
+	if_data.tx_msg.data.res_data_vector.vector_length_fi = VECTOR_LENGTH_FI;
+	if_data.tx_msg.data.res_data_vector.vector_length = o;
+	if_data.tx_msg.data.res_data_vector.vector_data_fi = VECTOR_DATA_FI;
+	if_data.tx_msg.var_data = vm_vector_buf;
+	if_data.tx_msg.var_crc = 0U != appData.regs.crc;
+	if_data.tx_state = IF_TX_STATE_ENCODE;
+}
+
+static void
+if_vm_pic_op (uint32_t address, uint32_t length)
+{
+	// Process read/write command that maps to PIC memory.
+	// This MUST only be called by if_vm_dispatch, as all the parameter
+	// validation is done there.
+	
+	if (IF_CMD_WRITE_REGS == if_data.rx_msg.command)
+	{
+		if (APP_RegsWrite(address, if_data.rx_msg.var_data, length))
+		{
+			if_vm_respstp(length);
+		}
+		else
+		{
+			// value out of range
+			if_vm_respstp(0);
+		}
+	}
+	else if (IF_CMD_READ_REGS == if_data.rx_msg.command)
+	{
+		if_vm_respstp(length);
+		if_data.tx_msg.var_data = &(((uint8_t *) &(appData.regs))[address]);
+	}
+}
+
+static void
+if_vm_dac_op (uint32_t address, uint32_t length)
+{
+	// Process read/write command that maps to DAC memory.
+	// This MUST only be called by if_vm_dispatch, as all the parameter
+	// validation is done there.
+	uint8_t ibuf[8] = {0};
+	uint16_t countz[4] = {0};
+	uint16_t addr = DAC_ADDRESS;
+	
+	if (IF_CMD_WRITE_REGS == if_data.rx_msg.command)
+	{
+		// Minimalist implementation: write 0xAA to first virtual address and
+		// the PIC will send out Mark's recommended values to the DAC.
+		// Memory mapping it will take a little more effort since it's not
+		// really set up that way on the DAC, for writes at least.
+		
+		memcpy(&(if_data.vm_dac_buf[address]), if_data.rx_msg.var_data,
+			length);
+		
+		if ((0 == address) && (0xAA == if_data.vm_dac_buf[0]))
+		{
+			// wait to update outputs
+			LDACn_Set();
+
+			// set vref
+			// A, B, C use internal 2.048V reference, D uses VDD (5V)
+			ibuf[0] = 0b10001110;
+			if (!DRV_I2C_WriteTransfer(if_data.h_i2c_dac, addr, ibuf, 1))
+			{
+				if_vm_respstp(0);
+				return;
+			}
+
+			// set gain to 1x for all
+			ibuf[0] = 0b11000000;
+			if (!DRV_I2C_WriteTransfer(if_data.h_i2c_dac, addr, ibuf, 1))
+			{
+				if_vm_respstp(0);
+				return;
+			}
+
+			// set outputs (fast write)
+			// A = 1200
+			// B = 1000
+			// C = 1012
+			// D = 255
+			// all PD = 0b00
+			countz[0] = cbs_endflip(1200);
+			countz[1] = cbs_endflip(1000);
+			countz[2] = cbs_endflip(1612);
+			countz[3] = cbs_endflip(0);
+			if (!DRV_I2C_WriteTransfer(if_data.h_i2c_dac, DAC_ADDRESS,
+				(void *) countz, 8))
+			{
+				if_vm_respstp(0);
+				return;
+			}
+
+			// update outputs
+			LDACn_Clear();
+
+			// Response of 0x55 is success, any other is failure
+			if_vm_respstp(0x55555555);
+		}
+		else if (2 == address && 8 == length)
+		{
+			// wait to update outputs
+			LDACn_Set();
+			
+			// set outputs (fast write)
+			countz[0] = cbs_endflip(((uint16_t *)if_data.vm_dac_buf)[1]);
+			countz[1] = cbs_endflip(((uint16_t *)if_data.vm_dac_buf)[2]);
+			countz[2] = cbs_endflip(((uint16_t *)if_data.vm_dac_buf)[3]);
+			countz[3] = cbs_endflip(((uint16_t *)if_data.vm_dac_buf)[4]);
+			if (!DRV_I2C_WriteTransfer(if_data.h_i2c_dac, DAC_ADDRESS,
+				(void *) countz, 8))
+			{
+				if_vm_respstp(0);
+				return;
+			}
+
+			// update outputs
+			LDACn_Clear();
+			if_vm_respstp(8);
+		}
+		else
+		{
+			// kept in vm_dac_buf for a later write to go out with
+			if_vm_respstp(length);
+		}
+	}
+	else if (IF_CMD_READ_REGS == if_data.rx_msg.command)
+	{
+		// not implemented, answered so a tagged read is not left waiting
+		if_vm_respstp(0);
+	}
+}
+
+static void
+if_vm_fpga_op (uint32_t address, uint32_t length)
+{
+	// Process read/write command that maps to FPGA memory.
+	// This MUST only be called by if_vm_dispatch, as all the parameter
+	// validation is done there.
+	
+	if (IF_CMD_WRITE_REGS == if_data.rx_msg.command)
+	{
+		memcpy(&(if_data.vm_fpga_buf[address]), if_data.rx_msg.var_data,
+			length);
+		
+		if (DRV_SPI_WriteTransfer(if_data.h_spi_fpga, if_data.vm_fpga_buf,
+			IF_VM_FPGA_LENGTH))
+		{
+			if_vm_respstp(IF_VM_FPGA_LENGTH);
+		}
+		else
+		{
+			// spi failure for some reason
+			if_vm_respstp(0);
+		}
+	}
+	else if (IF_CMD_READ_REGS == if_data.rx_msg.command)
+	{
+		if (DRV_SPI_ReadTransfer(if_data.h_spi_fpga, if_data.vm_fpga_buf,
+			IF_VM_FPGA_LENGTH))
+		{
+			if_vm_respstp(length);
+			if_data.tx_msg.var_data = &(if_data.vm_fpga_buf[address]);
+		}
+		else
+		{
+			// spi failure for some reason
+			if_vm_respstp(0);
+		}
+	}
+}
+
+static void
+if_vm_afe_op (uint32_t address, uint32_t length)
+{
+	// Process read/write command that maps to AFE memory.
+	// This MUST only be called by if_vm_dispatch, as all the parameter
+	// validation is done there.
+	
+	uint8_t flip[2];
+	uint8_t read[2] = { 0 };
+	
+	if (IF_CMD_WRITE_REGS == if_data.rx_msg.command)
+	{
+		memcpy(&(if_data.vm_afe_buf[address]), if_data.rx_msg.var_data,
+			length);
+		flip[0] = cbs_reverse(if_data.vm_afe_buf[1]);
+		flip[1] = cbs_reverse(if_data.vm_afe_buf[0]);
+		flip[0] |= 0b10000000;
+		
+		if (DRV_SPI_WriteTransfer(if_data.h_spi_afe, flip, 2))
+		{
+			if_vm_respstp(2);
+		}
+		else
+		{
+			// spi failure for some reason
+			if_vm_respstp(0);
+		}
+	}
+	else if (IF_CMD_READ_REGS == if_data.rx_msg.command)
+	{
+		if (DRV_SPI_WriteReadTransfer(if_data.h_spi_afe, read, 2, flip, 2))
+		{
+			if_data.vm_afe_buf[0] = cbs_reverse(flip[1]);
+			if_data.vm_afe_buf[1] = cbs_reverse(flip[0]);
+			
+			if_vm_respstp(length);
+			if_data.tx_msg.var_data = &(if_data.vm_afe_buf[address]);
+		}
+		else
+		{
+			// spi failure for some reason
+			if_vm_respstp(0);
+		}
+	}
+}
+
+static void
+if_vm_stat_op (uint32_t address, uint32_t length)
+{
+	// Process read/write command that maps to the statistics block.
+	// This MUST only be called by if_vm_dispatch, as all the parameter
+	// validation is done there.
+	
+	if (IF_CMD_WRITE_REGS == if_data.rx_msg.command)
+	{
+		// read only
+		if_vm_respstp(0);
+	}
+	else if (IF_CMD_READ_REGS == if_data.rx_msg.command)
+	{
+		// Snapshot so the counters don't move while the response is encoded
+		vm_stat_buf = appData.stats;
+		
+		if_vm_respstp(length);
+		if_data.tx_msg.var_data = &(((uint8_t *) &vm_stat_buf)[address]);
+	}
+}
+
+static void
+if_vm_hist_op (uint32_t address, uint32_t length)
+{
+	// Process read/write command that maps to the histogram counters.
+	// This MUST only be called by if_vm_dispatch, as all the parameter
+	// validation is done there.
+	
+	if (IF_CMD_WRITE_REGS == if_data.rx_msg.command)
+	{
+		// read only, cleared through the hist_waveforms register
+		if_vm_respstp(0);
+	}
+	else if (IF_CMD_READ_REGS == if_data.rx_msg.command)
+	{
+		if (address > appData.hist_size
+			|| length > appData.hist_size - address)
+		{
+			// not in histogram mode, or past the counters in use
+			if_vm_respstp(0);
+			return;
+		}
+		
+		// Read in place, it is too big for a snapshot. Counts taken while
+		// the response goes out may or may not be in it.
+		if_vm_respstp(length);
+		if_data.tx_msg.var_data = &(((uint8_t *) appData.hist)[address]);
+	}
+}
+
+static void
+if_vm_mask_op (uint32_t address, uint32_t length)
+{
+	// Process read/write command that maps to the mask test limits, a
+	// lower and upper byte per sample point.
+	// This MUST only be called by if_vm_dispatch, as all the parameter
+	// validation is done there.
+	
+	if (IF_CMD_WRITE_REGS == if_data.rx_msg.command)
+	{
+		memcpy(&(app_mask[address]), if_data.rx_msg.var_data, length);
+		if_vm_respstp(length);
+	}
+	else if (IF_CMD_READ_REGS == if_data.rx_msg.command)
+	{
+		if_vm_respstp(length);
+		if_data.tx_msg.var_data = &(app_mask[address]);
+	}
+}
+
+static void
+if_vm_respstp (uint32_t length)
+{
+	// Set up the appropriate response for a read or write command
+	// For write, the user still needs to set the var_data pointer
+	
+	if (IF_CMD_WRITE_REGS == if_data.rx_msg.command)
+	{
+		if_data.tx_msg.type = IF_MSG_RESULT;
+		if_data.tx_msg.command = IF_CMD_WRITE_REGS;
+		if_data.tx_msg.data.res_data_write_regs.write_length_fi =
+			WRITE_LENGTH_FI;
+		if_data.tx_msg.data.res_data_write_regs.write_length = length;
+		
+		if_data.tx_state = IF_TX_STATE_ENCODE;
+	}
+	else if (IF_CMD_READ_REGS == if_data.rx_msg.command)
+	{
+		if_data.tx_msg.type = IF_MSG_RESULT;
+		if_data.tx_msg.command = IF_CMD_READ_REGS;
+		if_data.tx_msg.data.res_data_read_regs.read_length_fi =
+			READ_LENGTH_FI;
+		if_data.tx_msg.data.res_data_read_regs.read_data_fi =
+			READ_DATA_FI;
+		if_data.tx_msg.data.res_data_read_regs.read_length = length;
+		if_data.tx_msg.var_crc = 0U != appData.regs.crc;
+		
+		if_data.tx_state = IF_TX_STATE_ENCODE;
+	}
+}
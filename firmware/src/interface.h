@@ -1,197 +1,567 @@
-/*
- * Host Interface
- * 
- * @Company
- *   Probe-Scope Team
- * 
- * @File Name
- *   interface.h
- * 
- * @Summary
- *   Interface according to Probe-Scope CDC Interface Spec v1.0.docx
-*/
-
-#ifndef INTERFACE_H
-#define	INTERFACE_H
-
-
-#include "app.h"
-
-#include <stdbool.h>
-#include <stdint.h>
-
-
-#define IF_START_MESSAGE  0x1E
-#define IF_END_MESSAGE    0x04
-#define IF_END_BLOCK      0x17
-#define IF_ESCAPE         0x1A
-
-#define IF_VM_PIC_START   0x00001000
-#define IF_VM_PIC_END     0x00001007
-#define IF_VM_PIC_LENGTH  (IF_VM_PIC_END - IF_VM_PIC_START + 1)
-#define IF_VM_FPGA_START  0x00002000
-#define IF_VM_FPGA_END    0x00002002
-#define IF_VM_FPGA_LENGTH (IF_VM_FPGA_END - IF_VM_FPGA_START + 1)
-#define IF_VM_AFE_START   0x00003000
-#define IF_VM_AFE_END     0x00003001
-#define IF_VM_AFE_LENGTH  (IF_VM_AFE_END - IF_VM_AFE_START + 1)
-#define IF_VM_DAC_START   0x00004000
-#define IF_VM_DAC_END     0x00004010
-#define IF_VM_DAC_LENGTH  (IF_VM_DAC_END - IF_VM_DAC_START + 1)
-
-#define SAMPLE_DATA_LENGTH_FI 'L'
-#define SAMPLE_DATA_FI        'D'
-#define WRITE_ADDRESS_FI      'A'
-#define WRITE_LENGTH_FI       'L'
-#define WRITE_DATA_FI         'D'
-#define READ_ADDRESS_FI       'A'
-#define READ_LENGTH_FI        'L'
-#define READ_DATA_FI          'D'
-
-#define DAC_ADDRESS (0b1100000)
-
-#define BUFFER_MARGIN 100U
-#define MAX_INCOMING_MESSAGE (256U * 2U + 15U + BUFFER_MARGIN)
-#define MAX_OUTGOING_MESSAGE (SAMPLES * 2 + BUFFER_MARGIN)
-
-
-#ifdef	__cplusplus
-extern "C"
-{
-#endif
-
-
-typedef enum
-{
-	IF_STATE_INIT = 0,
-	IF_STATE_WAIT,
-	IF_STATE_PROCESS_HOST_MSG,
-	IF_STATE_SEND_HW_MSG
-} if_states_t;
-
-typedef enum
-{
-	IF_TX_STATE_WAIT = 0,
-	IF_TX_STATE_ENCODE,
-	IF_TX_STATE_TRANSMIT,
-	IF_TX_STATE_TRANSMITTING		
-} if_tx_states_t;
-
-typedef enum
-{
-	IF_RX_STATE_WAIT = 0,
-	IF_RX_STATE_RECEIVING,
-	IF_RX_STATE_DECODE,
-	IF_RX_STATE_MSG_READY
-} if_rx_states_t;
-
-typedef enum
-{
-	IF_MSG_COMMAND = 0x43, // 'C'
-	IF_MSG_RESULT  = 0x52  // 'R'
-} if_msg_type_t;
-
-typedef enum
-{
-	IF_CMD_REQ_SAMP_DATA = 0x73, // 's'
-	IF_CMD_TRIGGERED =     0x74, // 't'
-	IF_CMD_WRITE_REGS =    0x77, // 'w'
-	IF_CMD_READ_REGS =     0x72  // 'r'
-} if_commands_t;
-
-
-typedef struct __attribute__((__packed__))
-{
-	char     sample_data_length_fi;
-	uint32_t sample_data_length;
-	char     sample_data_fi;
-} if_res_data_req_samp_data_t;
-
-typedef struct __attribute__((__packed__))
-{
-	char     write_address_fi;
-	uint32_t write_address;
-	char     write_length_fi;
-	uint32_t write_length;
-	char     write_data_fi;
-} if_cmd_data_write_regs_t;
-
-typedef struct __attribute__((__packed__))
-{
-	char     write_length_fi;
-	uint32_t write_length;
-} if_res_data_write_regs_t;
-
-typedef struct __attribute__((__packed__))
-{
-	char     read_address_fi;
-	uint32_t read_address;
-	char     read_length_fi;
-	uint32_t read_length;
-} if_cmd_data_read_regs_t;
-
-typedef struct __attribute__((__packed__))
-{
-	char     read_length_fi;
-	uint32_t read_length;
-	char     read_data_fi;
-} if_res_data_read_regs_t;
-
-typedef union
-{
-	if_res_data_req_samp_data_t res_data_req_samp_data;
-	if_cmd_data_write_regs_t    cmd_data_write_regs;
-	if_res_data_write_regs_t    res_data_write_regs;
-	if_cmd_data_read_regs_t     cmd_data_read_regs;
-	if_res_data_read_regs_t     res_data_read_regs;
-	uint8_t                     bytes[1];
-} if_msg_data_t;
-
-typedef struct
-{
-	if_msg_type_t   type;
-	if_commands_t   command;
-	if_msg_data_t   data;
-	unsigned char * var_data;
-	unsigned int    length;
-} if_message_t;
-
-typedef struct
-{
-	if_states_t     state;
-	
-	if_tx_states_t  tx_state;
-	unsigned int    tx_error_count;
-	bool            tx_error_flag;
-	
-	if_rx_states_t  rx_state;
-	unsigned int    rx_error_count;
-	bool            rx_error_flag;
-	
-	if_message_t    tx_msg;
-	if_message_t    rx_msg;
-	
-	bool            wait_trigger;
-	
-	/// ext if
-	DRV_HANDLE      h_i2c_dac;
-	DRV_HANDLE      h_spi_fpga;
-	DRV_HANDLE      h_spi_afe;
-	
-	uint8_t         vm_pic_buf [IF_VM_PIC_LENGTH];
-	uint8_t         vm_dac_buf [IF_VM_DAC_LENGTH];
-	uint8_t         vm_fpga_buf[IF_VM_FPGA_LENGTH];
-	uint8_t         vm_afe_buf [IF_VM_AFE_LENGTH];
-} if_data_t;
-
-
-void if_init (void);
-void if_task (void);
-
-
-#ifdef	__cplusplus
-}
-#endif
-
-#endif	/* INTERFACE_H */
-
+/*
+ * Host Interface
+ * 
+ * @Company
+ *   Probe-Scope Team
+ * 
+ * @File Name
+ *   interface.h
+ * 
+ * @Summary
+ *   Interface according to Probe-Scope CDC Interface Spec v1.0.docx
+*/
+
+#ifndef INTERFACE_H
+#define	INTERFACE_H
+
+
+#include "app.h"
+#include "codec.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+#define IF_START_MESSAGE  0x1E
+#define IF_END_MESSAGE    0x04
+#define IF_END_BLOCK      0x17
+#define IF_ESCAPE         0x1A
+
+// Every byte that is escaped is below this
+#define IF_ESCAPE_BELOW   0x20U
+
+// Framings of outgoing messages, chosen with IF_CMD_FRAMING. Under
+// IF_FRAMING_ESCAPED, the default, a message runs from IF_START_MESSAGE to
+// IF_END_MESSAGE with the framing bytes in between escaped. Under
+// IF_FRAMING_LENGTH IF_START_MESSAGE, type and command are followed by a
+// 32 bit little endian count of the bytes after it, which go as they are.
+// Messages from the host are escaped under either.
+//
+// With app_regs_t crc set, sample data and register reads carry a 32 bit
+// little endian CRC-32 (see crc.h) of the variable data after it. With
+// compression on, it is the CRC of the samples before coding and it
+// follows the coded bytes, so a host checks it against what it decoded.
+// It is escaped and counted like the rest.
+//
+// A command sent as IF_MSG_COMMAND_TAGGED carries a tag byte after the
+// command, escaped like the data. Its answer is IF_MSG_RESULT_TAGGED with
+// the same tag after the command, escaped under IF_FRAMING_ESCAPED and
+// before the count under IF_FRAMING_LENGTH. Commands are queued, up to
+// IF_RX_QUEUE of them may be sent without waiting for answers, which go
+// out in order.
+// Events sent unasked as IF_CMD_EVENT, the ones set in app_regs_t notify.
+// Events that come while a message goes out are sent together after it.
+#define IF_EVENT_TRIGGER  (1U << 0)   // a record was captured
+#define IF_EVENT_FRAME    (1U << 1)   // a frame was queued to be sent
+#define IF_EVENT_OVERFLOW (1U << 2)   // a frame was dropped unsent
+#define IF_EVENTS         (IF_EVENT_TRIGGER | IF_EVENT_FRAME | IF_EVENT_OVERFLOW)
+
+#define IF_FRAMING_ESCAPED 0U
+#define IF_FRAMING_LENGTH  1U
+#define IF_FRAMINGS        ((1U << IF_FRAMING_ESCAPED) | (1U << IF_FRAMING_LENGTH))
+
+#define IF_VM_PIC_START   0x00001000
+#define IF_VM_PIC_END     (IF_VM_PIC_START + IF_VM_PIC_LENGTH - 1)
+#define IF_VM_PIC_LENGTH  (sizeof(app_regs_t))
+#define IF_VM_FPGA_START  0x00002000
+#define IF_VM_FPGA_END    0x00002002
+#define IF_VM_FPGA_LENGTH (IF_VM_FPGA_END - IF_VM_FPGA_START + 1)
+#define IF_VM_AFE_START   0x00003000
+#define IF_VM_AFE_END     0x00003001
+#define IF_VM_AFE_LENGTH  (IF_VM_AFE_END - IF_VM_AFE_START + 1)
+#define IF_VM_DAC_START   0x00004000
+#define IF_VM_DAC_END     0x00004010
+#define IF_VM_DAC_LENGTH  (IF_VM_DAC_END - IF_VM_DAC_START + 1)
+#define IF_VM_STAT_START  0x00005000
+#define IF_VM_STAT_END    (IF_VM_STAT_START + IF_VM_STAT_LENGTH - 1)
+#define IF_VM_STAT_LENGTH (sizeof(app_stats_t))
+#define IF_VM_HIST_START  0x00100000
+#define IF_VM_HIST_END    (IF_VM_HIST_START + IF_VM_HIST_LENGTH - 1)
+#define IF_VM_HIST_LENGTH APP_HIST_MAX
+#define IF_VM_MASK_START  0x00200000
+#define IF_VM_MASK_END    (IF_VM_MASK_START + IF_VM_MASK_LENGTH - 1)
+#define IF_VM_MASK_LENGTH (2U * APP_MASK_POINTS)
+
+#define SAMPLE_DATA_LENGTH_FI 'L'
+#define SAMPLE_DATA_FI        'D'
+#define LOGIC_DATA_LENGTH_FI  'M'
+#define PEAK_RECORD_LENGTH_FI 'P'
+#define AVERAGE_COUNT_FI      'A'
+#define AVERAGE16_COUNT_FI    'H'
+#define SAMPLE_CODEC_FI       'Z'
+#define SPECTRUM_LENGTH_FI    'F'
+#define SPECTRUM_LOG_FI       'G'
+#define MEASURE_SEQ_FI        'Q'
+#define MEASURE_DATA_FI       'V'
+#define SEGMENT_COUNT_FI      'N'
+#define SEGMENT_LENGTH_FI     'L'
+#define SEGMENT_STAMPS_FI     'T'
+#define FRAMING_FI            'F'
+#define FRAMINGS_FI           'S'
+#define STREAM_SEQ_FI         'Q'
+#define STREAM_LENGTH_FI      'L'
+#define STREAM_DATA_FI        'D'
+#define WRITE_ADDRESS_FI      'A'
+#define WRITE_LENGTH_FI       'L'
+#define WRITE_DATA_FI         'D'
+#define READ_ADDRESS_FI       'A'
+#define READ_LENGTH_FI        'L'
+#define READ_DATA_FI          'D'
+#define VECTOR_COUNT_FI       'N'
+#define VECTOR_LENGTH_FI      'L'
+#define VECTOR_DATA_FI        'D'
+#define EVENT_FI              'E'
+#define EVENT_TRIGGERS_FI     'T'
+#define EVENT_FRAMES_FI       'Q'
+#define EVENT_DROPPED_FI      'X'
+
+#define DAC_ADDRESS (0b1100000)
+
+// Messages go out escaped a high speed bulk packet at a time, into one
+// buffer while the other is on the bus. Records of any length need only
+// these.
+#define IF_TX_PACKET  512U
+#define IF_TX_BUFFERS COMMS_TX_DEPTH
+
+#define BUFFER_MARGIN 100U
+#define MAX_INCOMING_MESSAGE (256U * 2U + 15U + BUFFER_MARGIN)
+
+// Commands received but not processed yet, a power of two
+#define IF_RX_QUEUE   8U
+#define IF_RX_VAR_MAX 256U
+
+// Room for the answer to IF_CMD_VECTOR, status words and read data
+#define IF_VECTOR_OUT 1024U
+
+
+#ifdef	__cplusplus
+extern "C"
+{
+#endif
+
+
+typedef enum
+{
+	IF_STATE_INIT = 0,
+	IF_STATE_WAIT,
+	IF_STATE_PROCESS_HOST_MSG,
+	IF_STATE_SEND_HW_MSG
+} if_states_t;
+
+typedef enum
+{
+	IF_TX_STATE_WAIT = 0,
+	IF_TX_STATE_ENCODE,
+	IF_TX_STATE_ENCODE_NEXT,
+	IF_TX_STATE_TRANSMIT,
+	IF_TX_STATE_DRAIN
+} if_tx_states_t;
+
+// What part of a message if_tx_fill() takes bytes from next
+typedef enum
+{
+	IF_TX_PART_DATA = 0,
+	IF_TX_PART_VAR,
+	IF_TX_PART_CRC,
+	IF_TX_PART_END,
+	IF_TX_PART_DONE
+} if_tx_parts_t;
+
+typedef enum
+{
+	IF_RX_STATE_WAIT = 0,
+	IF_RX_STATE_RECEIVING,
+	IF_RX_STATE_DECODE
+} if_rx_states_t;
+
+typedef enum
+{
+	IF_MSG_COMMAND        = 0x43, // 'C'
+	IF_MSG_RESULT         = 0x52, // 'R'
+	IF_MSG_COMMAND_TAGGED = 0x63, // 'c'
+	IF_MSG_RESULT_TAGGED  = 0x72  // 'r'
+} if_msg_type_t;
+
+typedef enum
+{
+	IF_CMD_REQ_SAMP_DATA = 0x73, // 's'
+	IF_CMD_TRIGGERED =     0x74, // 't'
+	IF_CMD_WRITE_REGS =    0x77, // 'w'
+	IF_CMD_READ_REGS =     0x72, // 'r'
+	IF_CMD_SEGMENTS =      0x67, // 'g'
+	IF_CMD_STREAM_DATA =   0x64, // 'd'
+	IF_CMD_MEASURE =       0x6D, // 'm'
+	IF_CMD_FRAMING =       0x66, // 'f'
+	IF_CMD_VECTOR =        0x76, // 'v'
+	IF_CMD_EVENT =         0x65  // 'e'
+} if_commands_t;
+
+
+typedef struct __attribute__((__packed__))
+{
+	char     sample_data_length_fi;
+	uint32_t sample_data_length;
+	char     sample_data_fi;
+} if_res_data_req_samp_data_t;
+
+// Answer to IF_CMD_REQ_SAMP_DATA in mixed-signal mode, told apart by the
+// field after the sample length. The samples are followed by
+// CAPTURE_LOGIC_CHANNELS bit planes, logic_data_length bytes in all.
+typedef struct __attribute__((__packed__))
+{
+	char     sample_data_length_fi;
+	uint32_t sample_data_length;
+	char     logic_data_length_fi;
+	uint32_t logic_data_length;
+	char     sample_data_fi;
+} if_res_data_mixed_t;
+
+// Answer to IF_CMD_REQ_SAMP_DATA with decimation on. The data is a min, max
+// byte pair per bucket, sample_data_length / 2 buckets standing for
+// peak_record_length samples.
+typedef struct __attribute__((__packed__))
+{
+	char     sample_data_length_fi;
+	uint32_t sample_data_length;
+	char     peak_record_length_fi;
+	uint32_t peak_record_length;
+	char     sample_data_fi;
+} if_res_data_peak_t;
+
+// Answer to IF_CMD_REQ_SAMP_DATA in average mode, the mean of average_count
+// records. Under AVERAGE16_COUNT_FI the samples are 16 bit little endian
+// with 8 fractional bits.
+typedef struct __attribute__((__packed__))
+{
+	char     sample_data_length_fi;
+	uint32_t sample_data_length;
+	char     average_count_fi;
+	uint32_t average_count;
+	char     sample_data_fi;
+} if_res_data_average_t;
+
+// Answer to IF_CMD_REQ_SAMP_DATA in spectrum mode, spectrum_length / 2
+// bins of a spectrum_length point transform. Under SPECTRUM_LENGTH_FI a
+// bin is 16 bit little endian linear, under SPECTRUM_LOG_FI 8 bit log, see
+// FFT_FORMAT_* in fft.h.
+typedef struct __attribute__((__packed__))
+{
+	char     sample_data_length_fi;
+	uint32_t sample_data_length;
+	char     spectrum_length_fi;
+	uint32_t spectrum_length;
+	char     sample_data_fi;
+} if_res_data_spectrum_t;
+
+// Answer to IF_CMD_REQ_SAMP_DATA with compression on. sample_data_length
+// samples follow coded with sample_codec (CODEC_*, see codec.h). The coded
+// length is not known up front, the bytes run to IF_END_MESSAGE (coding is
+// only done under IF_FRAMING_ESCAPED), less the 4 byte CRC trailer with crc
+// set. Decoding ends on the byte that completes sample_data_length
+// samples, the trailer is the 4 bytes after it.
+typedef struct __attribute__((__packed__))
+{
+	char     sample_data_length_fi;
+	uint32_t sample_data_length;
+	char     sample_codec_fi;
+	uint32_t sample_codec;
+	char     sample_data_fi;
+} if_res_data_coded_t;
+
+// Answer to IF_CMD_MEASURE, the measurements of the next frame in place of
+// its samples. The variable data is a measure_result_t (see measure.h),
+// frame_seq counts captured frames so a gap means frames went unmeasured.
+typedef struct __attribute__((__packed__))
+{
+	char     frame_seq_fi;
+	uint32_t frame_seq;
+	char     measure_data_fi;
+} if_res_data_measure_t;
+
+// Answer to IF_CMD_REQ_SAMP_DATA in segmented mode. The variable data is
+// segment_count 64 bit timestamps followed by the segments, back to back.
+typedef struct __attribute__((__packed__))
+{
+	char     segment_count_fi;
+	uint32_t segment_count;
+	char     segment_length_fi;
+	uint32_t segment_length;
+	char     segment_stamps_fi;
+} if_res_data_segments_t;
+
+// Asks for IF_FRAMING_* from the next message on
+typedef struct __attribute__((__packed__))
+{
+	char     framing_fi;
+	uint32_t framing;
+} if_cmd_data_framing_t;
+
+// Answer to IF_CMD_FRAMING, still in the framing it was asked under. The
+// framing from the next message on, unchanged if the one asked for is not
+// among framings, a bit per IF_FRAMING_*.
+typedef struct __attribute__((__packed__))
+{
+	char     framing_fi;
+	uint32_t framing;
+	char     framings_fi;
+	uint32_t framings;
+} if_res_data_framing_t;
+
+// Roll mode chunk, sent unrequested. stream_seq counts captured chunks, so
+// a gap means chunks were dropped on the device.
+typedef struct __attribute__((__packed__))
+{
+	char     stream_seq_fi;
+	uint32_t stream_seq;
+	char     stream_length_fi;
+	uint32_t stream_length;
+	char     stream_data_fi;
+} if_cmd_data_stream_data_t;
+
+typedef struct __attribute__((__packed__))
+{
+	char     write_address_fi;
+	uint32_t write_address;
+	char     write_length_fi;
+	uint32_t write_length;
+	char     write_data_fi;
+} if_cmd_data_write_regs_t;
+
+typedef struct __attribute__((__packed__))
+{
+	char     write_length_fi;
+	uint32_t write_length;
+} if_res_data_write_regs_t;
+
+typedef struct __attribute__((__packed__))
+{
+	char     read_address_fi;
+	uint32_t read_address;
+	char     read_length_fi;
+	uint32_t read_length;
+} if_cmd_data_read_regs_t;
+
+typedef struct __attribute__((__packed__))
+{
+	char     read_length_fi;
+	uint32_t read_length;
+	char     read_data_fi;
+} if_res_data_read_regs_t;
+
+// Sent unrequested, the IF_EVENT_* bits that happened since the last one
+// and the running counts behind them: app_stats_t trig_count, frames
+// queued (the next frame_seq) and app_stats_t frames_dropped.
+typedef struct __attribute__((__packed__))
+{
+	char     event_fi;
+	uint32_t events;
+	char     event_triggers_fi;
+	uint32_t event_triggers;
+	char     event_frames_fi;
+	uint32_t event_frames;
+	char     event_dropped_fi;
+	uint32_t event_dropped;
+} if_cmd_data_event_t;
+
+// Register reads and writes in one go, vector_count entries in
+// vector_length bytes of variable data. An entry is an if_vector_op_t,
+// followed by length bytes to write under IF_CMD_WRITE_REGS. Entries run
+// in order, each as the command it names would.
+typedef struct __attribute__((__packed__))
+{
+	char     vector_count_fi;
+	uint32_t vector_count;
+	char     vector_length_fi;
+	uint32_t vector_length;
+	char     vector_data_fi;
+} if_cmd_data_vector_t;
+
+typedef struct __attribute__((__packed__))
+{
+	uint8_t  command;   // IF_CMD_WRITE_REGS or IF_CMD_READ_REGS
+	uint32_t address;
+	uint32_t length;
+} if_vector_op_t;
+
+// Answer to IF_CMD_VECTOR. The variable data is a 32 bit little endian
+// status per entry, the length its own answer would carry (0 on failure or
+// if it was not run), then the data of the reads in order. Entries after
+// one that is cut short or does not fit IF_VECTOR_OUT are not run.
+typedef struct __attribute__((__packed__))
+{
+	char     vector_count_fi;
+	uint32_t vector_count;
+	char     vector_length_fi;
+	uint32_t vector_length;
+	char     vector_data_fi;
+} if_res_data_vector_t;
+
+typedef union
+{
+	if_res_data_req_samp_data_t res_data_req_samp_data;
+	if_res_data_mixed_t         res_data_mixed;
+	if_res_data_peak_t          res_data_peak;
+	if_res_data_average_t       res_data_average;
+	if_res_data_coded_t         res_data_coded;
+	if_res_data_spectrum_t      res_data_spectrum;
+	if_res_data_segments_t      res_data_segments;
+	if_res_data_measure_t       res_data_measure;
+	if_cmd_data_framing_t       cmd_data_framing;
+	if_res_data_framing_t       res_data_framing;
+	if_cmd_data_stream_data_t   cmd_data_stream_data;
+	if_cmd_data_write_regs_t    cmd_data_write_regs;
+	if_res_data_write_regs_t    res_data_write_regs;
+	if_cmd_data_read_regs_t     cmd_data_read_regs;
+	if_res_data_read_regs_t     res_data_read_regs;
+	if_cmd_data_vector_t        cmd_data_vector;
+	if_cmd_data_event_t         cmd_data_event;
+	if_res_data_vector_t        res_data_vector;
+	uint8_t                     bytes[1];
+} if_msg_data_t;
+
+// The messages, X(command, data length, variable length, handler): the
+// commands the host sends, the results it gets and the notices, commands
+// only the device sends. A notice from the host is rejected as unknown and
+// not answered. The data length is in bytes of if_msg_data_t, IF_LEN_OWN
+// where the field identifiers in it tell. The variable length is the
+// uint32_t at IF_VAR(field), IF_VAR_NONE, or IF_VAR_OWN where it takes more
+// than one field. handler runs a command from the host, NULL for the
+// others. Commands are lowercase letters, interface.c looks them up by
+// letter.
+#define IF_LEN_OWN   0xFFU
+#define IF_VAR(f)    offsetof(if_msg_data_t, f)
+#define IF_VAR_NONE  0xFFFFU
+#define IF_VAR_OWN   0xFFFEU
+
+#define IF_COMMANDS(X) \
+	X(IF_CMD_REQ_SAMP_DATA, 0, IF_VAR_NONE, if_cmd_req_samp_data) \
+	X(IF_CMD_WRITE_REGS, sizeof(if_cmd_data_write_regs_t), \
+		IF_VAR(cmd_data_write_regs.write_length), if_vm_dispatch) \
+	X(IF_CMD_READ_REGS, sizeof(if_cmd_data_read_regs_t), IF_VAR_NONE, \
+		if_vm_dispatch) \
+	X(IF_CMD_MEASURE, 0, IF_VAR_NONE, if_cmd_measure) \
+	X(IF_CMD_FRAMING, sizeof(if_cmd_data_framing_t), IF_VAR_NONE, \
+		if_send_framing) \
+	X(IF_CMD_VECTOR, sizeof(if_cmd_data_vector_t), \
+		IF_VAR(cmd_data_vector.vector_length), if_vm_vector)
+
+#define IF_NOTICES(X) \
+	X(IF_CMD_TRIGGERED, 0, IF_VAR_NONE, NULL) \
+	X(IF_CMD_STREAM_DATA, sizeof(if_cmd_data_stream_data_t), \
+		IF_VAR(cmd_data_stream_data.stream_length), NULL) \
+	X(IF_CMD_EVENT, sizeof(if_cmd_data_event_t), IF_VAR_NONE, NULL)
+
+#define IF_RESULTS(X) \
+	X(IF_CMD_REQ_SAMP_DATA, IF_LEN_OWN, IF_VAR_OWN, NULL) \
+	X(IF_CMD_SEGMENTS, sizeof(if_res_data_segments_t), IF_VAR_OWN, NULL) \
+	X(IF_CMD_MEASURE, sizeof(if_res_data_measure_t), IF_VAR_OWN, NULL) \
+	X(IF_CMD_WRITE_REGS, sizeof(if_res_data_write_regs_t), IF_VAR_NONE, \
+		NULL) \
+	X(IF_CMD_READ_REGS, sizeof(if_res_data_read_regs_t), \
+		IF_VAR(res_data_read_regs.read_length), NULL) \
+	X(IF_CMD_FRAMING, sizeof(if_res_data_framing_t), IF_VAR_NONE, NULL) \
+	X(IF_CMD_VECTOR, sizeof(if_res_data_vector_t), \
+		IF_VAR(res_data_vector.vector_length), NULL)
+
+typedef struct
+{
+	if_msg_type_t   type;
+	if_commands_t   command;
+	if_msg_data_t   data;
+	unsigned char * var_data;
+	unsigned char * var_wrap;     // var_data continues here from var_wrap_at
+	unsigned int    var_wrap_at;  // 0 if var_data is in one piece
+	uint8_t         var_codec;    // CODEC_* applied to var_data on the way
+	bool            var_direct;   // var_data is DMA safe, may go out in place
+	bool            var_crc;      // a CRC-32 of var_data goes after it
+	bool            tagged;       // type goes tagged, tag after the command
+	uint8_t         tag;
+	unsigned int    length;
+} if_message_t;
+
+typedef struct
+{
+	if_message_t    msg;
+	uint8_t         var[IF_RX_VAR_MAX];  // msg.var_data
+} if_rx_slot_t;
+
+typedef struct
+{
+	if_states_t     state;
+	
+	unsigned int    framing;        // IF_FRAMING_* of messages going out
+	unsigned int    framing_next;   // and from the next message on
+	
+	if_tx_states_t  tx_state;
+	if_tx_parts_t   tx_part;
+	unsigned int    tx_framing;     // framing of the message going out
+	bool            tx_direct;      // var_data is going out in place
+	uint8_t *       tx_out;         // what is handed to comms next
+	unsigned int    tx_buffer;      // out_buffer filled next
+	unsigned int    tx_data_offset;
+	unsigned int    tx_data_length;
+	const uint8_t * tx_span;        // variable data not escaped yet
+	unsigned int    tx_span_length;
+	bool            tx_held;        // escaped byte left for the next packet
+	uint8_t         tx_held_byte;
+	uint8_t         tx_trailer[4];  // the CRC, once the engine has it
+	unsigned int    tx_trailer_offset;
+	unsigned int    tx_trailer_length;
+	uint32_t        tx_crc_ticks;
+	unsigned int    tx_var_offset;
+	unsigned int    tx_var_length;
+	codec_state_t   tx_codec;
+	uint32_t        tx_coded;
+	uint32_t        tx_codec_ticks;
+	unsigned int    tx_error_count;
+	bool            tx_error_flag;
+	
+	if_rx_states_t  rx_state;
+	unsigned int    rx_error_count;
+	bool            rx_error_flag;
+	if_rx_slot_t    rx_queue[IF_RX_QUEUE];
+	unsigned int    rx_head;        // decoded into next, free running
+	unsigned int    rx_tail;        // processed next
+	
+	if_message_t    tx_msg;
+	if_message_t    rx_msg;         // out of rx_queue, being processed
+	
+	bool            wait_trigger;
+	bool            wait_measure;
+	bool            trigger_tagged; // tags of the commands these answer
+	uint8_t         trigger_tag;
+	bool            measure_tagged;
+	uint8_t         measure_tag;
+	uint32_t        event_triggers; // counts as of the last IF_CMD_EVENT
+	uint32_t        event_frames;
+	uint32_t        event_dropped;
+	struct rudimentary_buffer * tx_frame;
+	
+	/// ext if
+	DRV_HANDLE      h_i2c_dac;
+	DRV_HANDLE      h_spi_fpga;
+	DRV_HANDLE      h_spi_afe;
+	
+	uint8_t         vm_dac_buf [IF_VM_DAC_LENGTH];
+	uint8_t         vm_fpga_buf[IF_VM_FPGA_LENGTH];
+	uint8_t         vm_afe_buf [IF_VM_AFE_LENGTH];
+} if_data_t;
+
+
+void if_init (void);
+void if_task (void);
+bool if_idle (void);
+
+// Framing bytes in in escaped into out, which takes up to 2 * length.
+// Returns the bytes written.
+unsigned int if_escape (uint8_t * out, const uint8_t * in,
+                        unsigned int length);
+
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* INTERFACE_H */
+
@@ -0,0 +1,208 @@
+/*
+ * Automatic Measurements
+ *
+ * @Company
+ *   Probe-Scope Team
+ *
+ * @File Name
+ *   measure.c
+ *
+ * @Summary
+ *   Scalar waveform measurements over captured records, in fixed point
+*/
+
+#include "measure.h"
+
+#include "dsp.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+
+#define MEASURE_LEVEL_NONE 0
+#define MEASURE_LEVEL_LOW  1
+#define MEASURE_LEVEL_HIGH 2
+
+
+static uint32_t
+measure_sqrt (uint64_t x)
+{
+	// Bit by bit, one result bit per step
+	uint64_t root = 0;
+	uint64_t bit = 1ULL << 62;
+
+	while (bit > x)
+	{
+		bit >>= 2;
+	}
+
+	while (bit)
+	{
+		if (x >= root + bit)
+		{
+			x -= root + bit;
+			root = (root >> 1) + bit;
+		}
+		else
+		{
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+
+	return (uint32_t) root;
+}
+
+void
+measure_init (measure_state_t * state, uint32_t requested)
+{
+	memset(state, 0, sizeof(*state));
+	state->requested = requested;
+	state->min = 0xFF;
+	state->max = 0;
+}
+
+void
+measure_levels (measure_state_t * state, const uint8_t * in, uint32_t length)
+{
+	// The edge pass needs min and max for its thresholds, the sums are
+	// only worth their time for mean and RMS
+	dsp_minmax(in, length, &(state->min), &(state->max));
+	if (state->requested & (MEASURE_MEAN | MEASURE_RMS))
+	{
+		dsp_sums(in, length, &(state->sum), &(state->squares));
+	}
+	state->count += length;
+}
+
+void
+measure_edges (measure_state_t * state, const uint8_t * in, uint32_t length)
+{
+	// A 10 % / 90 % comparator with hysteresis finds the edges, the last
+	// 50 % crossing before it switches is the time of the edge. Rise and
+	// fall run from the last sample beyond one threshold to the first
+	// beyond the other.
+	uint32_t i;
+
+	if (0 == length
+		|| (uint32_t) (state->max - state->min) < MEASURE_SWING_MIN)
+	{
+		return;
+	}
+
+	if (0 == state->index)
+	{
+		uint32_t swing = state->max - state->min;
+
+		state->low = (uint8_t) (state->min + swing / 10U);
+		state->mid = (uint8_t) (state->min + swing / 2U);
+		state->high = (uint8_t) (state->max - swing / 10U);
+		state->prev = in[0];
+	}
+
+	for (i = 0; i < length; i++)
+	{
+		uint8_t s = in[i];
+		uint32_t t = state->index + i;
+
+		if (s >= state->mid && state->prev < state->mid)
+		{
+			state->up = t;
+		}
+		else if (s < state->mid && state->prev >= state->mid)
+		{
+			state->down = t;
+		}
+		state->prev = s;
+
+		if (s <= state->low)
+		{
+			if (MEASURE_LEVEL_HIGH == state->level)
+			{
+				state->falls++;
+				state->fall_sum += t - state->last_high;
+				if (state->rises)
+				{
+					state->highs++;
+					state->high_sum += state->down - state->last_up;
+				}
+			}
+			state->level = MEASURE_LEVEL_LOW;
+			state->last_low = t;
+		}
+		else if (s >= state->high)
+		{
+			if (MEASURE_LEVEL_LOW == state->level)
+			{
+				if (0 == state->rises)
+				{
+					state->first_up = state->up;
+				}
+				state->rises++;
+				state->rise_sum += t - state->last_low;
+				state->last_up = state->up;
+			}
+			state->level = MEASURE_LEVEL_HIGH;
+			state->last_high = t;
+		}
+	}
+
+	state->index += length;
+}
+
+void
+measure_result (const measure_state_t * state, uint32_t sample_rate,
+	measure_result_t * result)
+{
+	uint32_t valid = 0;
+	uint32_t span = state->last_up - state->first_up;
+
+	memset(result, 0, sizeof(*result));
+	if (0 == state->count)
+	{
+		return;
+	}
+
+	result->samples = state->count;
+	result->min = state->min;
+	result->max = state->max;
+	result->vpp = state->max - state->min;
+	result->mean = (uint32_t) (((state->sum << 8) + state->count / 2U)
+		/ state->count);
+	result->rms = measure_sqrt((state->squares << 16) / state->count);
+	result->edges = state->rises;
+	valid |= MEASURE_VPP | MEASURE_MEAN | MEASURE_RMS;
+
+	if (state->rises >= 2U && span)
+	{
+		result->period = (uint32_t) (((uint64_t) span << 8)
+			/ (state->rises - 1U));
+		// sample_rate 0 leaves it 0, the period is in samples anyway
+		result->frequency = (uint32_t) (((uint64_t) sample_rate
+			* (state->rises - 1U) + span / 2U) / span);
+		valid |= MEASURE_FREQ;
+
+		if (state->highs)
+		{
+			// Mean high time over mean period
+			result->duty = (uint32_t) (((uint64_t) state->high_sum * 1000U
+				* (state->rises - 1U)) / ((uint64_t) state->highs * span));
+			valid |= MEASURE_DUTY;
+		}
+	}
+
+	if (state->rises)
+	{
+		result->rise = (state->rise_sum << 8) / state->rises;
+		valid |= MEASURE_RISE;
+	}
+
+	if (state->falls)
+	{
+		result->fall = (state->fall_sum << 8) / state->falls;
+		valid |= MEASURE_FALL;
+	}
+
+	result->valid = valid & state->requested;
+}
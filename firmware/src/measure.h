@@ -0,0 +1,113 @@
+/*
+ * Automatic Measurements
+ *
+ * @Company
+ *   Probe-Scope Team
+ *
+ * @File Name
+ *   measure.h
+ *
+ * @Summary
+ *   Scalar waveform measurements over captured records, in fixed point
+*/
+
+#ifndef MEASURE_H
+#define	MEASURE_H
+
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+// Measurement select bits, see app_regs_t measure
+#define MEASURE_VPP   (1U << 0)  // min, max and peak to peak
+#define MEASURE_MEAN  (1U << 1)
+#define MEASURE_RMS   (1U << 2)
+#define MEASURE_FREQ  (1U << 3)  // period and frequency
+#define MEASURE_DUTY  (1U << 4)
+#define MEASURE_RISE  (1U << 5)  // 10 % to 90 %
+#define MEASURE_FALL  (1U << 6)  // 90 % to 10 %
+#define MEASURE_ALL   0x7FU
+
+// These need the second pass over the record
+#define MEASURE_EDGES (MEASURE_FREQ | MEASURE_DUTY | MEASURE_RISE \
+                       | MEASURE_FALL)
+
+// Signals with less swing than this have no edges, only noise
+#define MEASURE_SWING_MIN 8U
+
+
+#ifdef	__cplusplus
+extern "C"
+{
+#endif
+
+
+// Result of one record. Levels are in sample codes and times in samples,
+// both with 8 fractional bits. valid has the MEASURE_* bits that were
+// asked for and found, e.g. a frequency needs two rising edges.
+typedef struct __attribute__((__packed__))
+{
+	uint32_t valid;
+	uint32_t samples;    // record length measured
+	uint8_t  min;
+	uint8_t  max;
+	uint8_t  vpp;
+	uint32_t mean;
+	uint32_t rms;        // DC included
+	uint32_t period;
+	uint32_t frequency;  // Hz at the sample rate given to measure_result(),
+	                     // 0 without one
+	uint32_t duty;       // 0.1 %
+	uint32_t rise;
+	uint32_t fall;
+	uint32_t edges;      // rising edges in the record
+} measure_result_t;
+
+typedef struct
+{
+	uint32_t requested;
+	uint32_t count;
+	uint8_t  min;
+	uint8_t  max;
+	uint64_t sum;
+	uint64_t squares;
+	
+	// Edge pass, thresholds at 10 %, 50 % and 90 % of min..max
+	uint32_t index;
+	uint8_t  low;
+	uint8_t  mid;
+	uint8_t  high;
+	uint8_t  prev;
+	int      level;
+	uint32_t last_low;
+	uint32_t last_high;
+	uint32_t up;
+	uint32_t down;
+	uint32_t rises;
+	uint32_t rise_sum;
+	uint32_t falls;
+	uint32_t fall_sum;
+	uint32_t first_up;
+	uint32_t last_up;
+	uint32_t highs;
+	uint32_t high_sum;
+} measure_state_t;
+
+
+// A record is measured in two passes, levels then edges, each fed the
+// record in one or more spans in order
+void measure_init   (measure_state_t * state, uint32_t requested);
+void measure_levels (measure_state_t * state, const uint8_t * in,
+                     uint32_t length);
+void measure_edges  (measure_state_t * state, const uint8_t * in,
+                     uint32_t length);
+void measure_result (const measure_state_t * state, uint32_t sample_rate,
+                     measure_result_t * result);
+
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* MEASURE_H */
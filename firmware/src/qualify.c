@@ -0,0 +1,229 @@
+/*
+ * Trigger Qualifiers
+ *
+ * @Company
+ *   Probe-Scope Team
+ *
+ * @File Name
+ *   qualify.c
+ *
+ * @Summary
+ *   Second stage triggers, checked over captured records
+*/
+
+#include "qualify.h"
+
+#include "capture.h"
+#include "dsp.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+
+// Where the scan is. Each phase has a range of samples that keep it, the
+// scan jumps to the first sample outside with dsp_find_outside() and
+// decides on that one.
+#define QUALIFY_START  0  // before the first idle sample
+#define QUALIFY_IDLE   1
+#define QUALIFY_ACTIVE 2  // in a pulse
+#define QUALIFY_MID    3  // runt: past level, not yet level2
+#define QUALIFY_TOP    4  // runt: past level2, a full pulse
+
+
+void
+qualify_init (qualify_state_t * state, uint32_t qualify, uint8_t level,
+	uint8_t level2, uint32_t width)
+{
+	// Negative qualifiers run on 255 - sample, with the levels mirrored
+	memset(state, 0, sizeof(*state));
+	state->type = qualify & QUALIFY_TYPE_MASK;
+	state->negative = (0 != (qualify & QUALIFY_NEGATIVE));
+	state->level = level;
+	state->level2 = level2;
+	state->width = width;
+	state->phase = QUALIFY_START;
+
+	if (state->negative)
+	{
+		if (QUALIFY_RUNT == state->type)
+		{
+			state->level = (uint8_t) (255U - level2);
+			state->level2 = (uint8_t) (255U - level);
+		}
+		else
+		{
+			state->level = (uint8_t) (256U - level);
+		}
+	}
+}
+
+static void
+qualify_range (const qualify_state_t * state, uint8_t * lo, uint8_t * hi)
+{
+	// Samples that keep the current phase, as they would be if positive
+	uint8_t level = state->level;
+
+	*lo = 0;
+	*hi = 255;
+
+	if (QUALIFY_RUNT == state->type)
+	{
+		switch (state->phase)
+		{
+			case QUALIFY_START:
+			case QUALIFY_TOP:
+				*lo = level;
+				break;
+
+			case QUALIFY_IDLE:
+				*hi = (uint8_t) (level - 1U);
+				break;
+
+			default:
+				*lo = level;
+				*hi = (uint8_t) (state->level2 - 1U);
+				break;
+		}
+	}
+	else if (QUALIFY_IDLE == state->phase)
+	{
+		*hi = (uint8_t) (level - 1U);
+	}
+	else
+	{
+		*lo = level;
+	}
+}
+
+bool
+qualify_scan (qualify_state_t * state, const uint8_t * in, uint32_t length)
+{
+	uint32_t i = 0;
+
+	while (!state->match && i < length)
+	{
+		uint8_t lo;
+		uint8_t hi;
+		uint8_t s;
+		uint32_t t;
+
+		qualify_range(state, &lo, &hi);
+		if (state->negative)
+		{
+			i += dsp_find_outside(&(in[i]), length - i, (uint8_t) (255U - hi),
+				(uint8_t) (255U - lo));
+		}
+		else
+		{
+			i += dsp_find_outside(&(in[i]), length - i, lo, hi);
+		}
+		if (i >= length)
+		{
+			break;
+		}
+
+		s = state->negative ? (uint8_t) (255U - in[i]) : in[i];
+		t = state->index + i;
+
+		switch (state->phase)
+		{
+			case QUALIFY_START:
+			case QUALIFY_TOP:
+				state->phase = QUALIFY_IDLE;
+				break;
+
+			case QUALIFY_IDLE:
+				state->start = t;
+				state->phase = QUALIFY_ACTIVE;
+				if (QUALIFY_RUNT == state->type)
+				{
+					state->phase = (s >= state->level2)
+						? QUALIFY_TOP : QUALIFY_MID;
+				}
+				break;
+
+			case QUALIFY_MID:
+				// Back under level without reaching level2
+				state->match = (s < state->level);
+				state->phase = QUALIFY_TOP;
+				break;
+
+			default:
+				state->match = (QUALIFY_WIDER == state->type)
+					? (t - state->start > state->width)
+					: (t - state->start < state->width);
+				state->phase = QUALIFY_IDLE;
+				break;
+		}
+	}
+
+	// Still in a pulse at the end of the span, it may be wide enough
+	// already
+	if (QUALIFY_WIDER == state->type && QUALIFY_ACTIVE == state->phase
+		&& state->index + length - state->start > state->width)
+	{
+		state->match = true;
+	}
+
+	state->index += length;
+	return state->match;
+}
+
+bool
+qualify_pattern (const uint8_t * planes, uint32_t length, uint32_t pattern,
+	uint32_t width)
+{
+	// Eight samples a byte: AND the planes of the compared channels,
+	// inverted where the value is 0, then look for a long enough run of
+	// set bits
+	uint32_t plane = CAPTURE_LOGIC_PLANE(length);
+	uint32_t mask = QUALIFY_PATTERN_MASK(pattern);
+	uint32_t value = QUALIFY_PATTERN_VALUE(pattern);
+	uint32_t run = 0;
+	uint32_t b;
+	uint32_t c;
+
+	for (b = 0; b < plane; b++)
+	{
+		uint32_t hit = 0xFFU;
+		uint32_t n = length - 8U * b;
+		uint32_t i;
+
+		for (c = 0; c < CAPTURE_LOGIC_CHANNELS; c++)
+		{
+			if (mask & (1U << c))
+			{
+				uint32_t p = planes[c * plane + b];
+				hit &= (value & (1U << c)) ? p : ~p;
+			}
+		}
+
+		if (n < 8U)
+		{
+			// Past the last sample
+			hit &= (1U << n) - 1U;
+		}
+
+		if (0xFFU == hit)
+		{
+			run += 8U;
+			if (run >= width)
+			{
+				return true;
+			}
+			continue;
+		}
+
+		for (i = 0; i < 8U; i++)
+		{
+			run = (hit & (1U << i)) ? run + 1U : 0U;
+			if (run && run >= width)
+			{
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
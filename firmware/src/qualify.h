@@ -0,0 +1,76 @@
+/*
+ * Trigger Qualifiers
+ *
+ * @Company
+ *   Probe-Scope Team
+ *
+ * @File Name
+ *   qualify.h
+ *
+ * @Summary
+ *   Second stage triggers, checked over captured records
+*/
+
+#ifndef QUALIFY_H
+#define	QUALIFY_H
+
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+// Qualifier types, see app_regs_t qualify. Pulses are above level, or
+// below it with QUALIFY_NEGATIVE. A runt crosses level but turns back
+// before level2 (level < level2; mirrored if negative). Pulses already
+// going at the start of the record are not counted.
+#define QUALIFY_NONE      0U
+#define QUALIFY_WIDER     1U  // a pulse longer than width samples
+#define QUALIFY_NARROWER  2U  // a glitch, a pulse shorter than width
+#define QUALIFY_RUNT      3U
+#define QUALIFY_PATTERN   4U  // logic channels, mixed-signal mode only
+#define QUALIFY_TYPE_MASK 0xFFU
+#define QUALIFY_NEGATIVE  (1U << 8)
+
+// Pattern: channel n is compared if mask bit n is set, to value bit n.
+// It has to hold for width samples.
+#define QUALIFY_PATTERN_VALUE(p) ((p) & 0x3FU)
+#define QUALIFY_PATTERN_MASK(p)  (((p) >> 8) & 0x3FU)
+
+
+#ifdef	__cplusplus
+extern "C"
+{
+#endif
+
+
+typedef struct
+{
+	uint32_t type;
+	bool     negative;
+	uint8_t  level;
+	uint8_t  level2;
+	uint32_t width;
+	int      phase;
+	uint32_t index;
+	uint32_t start;
+	bool     match;
+} qualify_state_t;
+
+
+// Scan a record in one or more spans, in order. True once it qualifies,
+// the rest is not looked at.
+void qualify_init (qualify_state_t * state, uint32_t qualify, uint8_t level,
+                   uint8_t level2, uint32_t width);
+bool qualify_scan (qualify_state_t * state, const uint8_t * in,
+                   uint32_t length);
+
+// Pattern over the bit planes of length samples, see capture_logic_pack()
+bool qualify_pattern (const uint8_t * planes, uint32_t length,
+                      uint32_t pattern, uint32_t width);
+
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* QUALIFY_H */
@@ -0,0 +1,22 @@
+/*
+ * Host Build Configuration
+ * 
+ * @Company
+ *   Probe-Scope Team
+ * 
+ * @File Name
+ *   configuration.h
+ * 
+ * @Summary
+ *   Stands in for the Harmony configuration.h in host builds
+*/
+
+#ifndef CONFIGURATION_H
+#define	CONFIGURATION_H
+
+
+// Everything the sources take from here comes with definitions.h
+#include "definitions.h"
+
+
+#endif	/* CONFIGURATION_H */
@@ -0,0 +1,229 @@
+/*
+ * Host Build Definitions
+ * 
+ * @Company
+ *   Probe-Scope Team
+ * 
+ * @File Name
+ *   definitions.h
+ * 
+ * @Summary
+ *   Stands in for the Harmony definitions.h in host builds
+*/
+
+#ifndef DEFINITIONS_H
+#define	DEFINITIONS_H
+
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "capture_sim.h"
+
+
+#ifdef	__cplusplus
+extern "C"
+{
+#endif
+
+
+// The PIC32 CP0 count is the core timer, which the model keeps
+#define CACHE_ALIGN __attribute__((aligned(16)))
+#define _CP0_COUNT        9
+#define _CP0_COUNT_SELECT 0
+#define __builtin_mfc0(reg, sel) CORETIMER_CounterGet()
+
+
+/// FreeRTOS
+
+typedef long          BaseType_t;
+typedef uint32_t      TickType_t;
+typedef void *        TaskHandle_t;
+typedef enum { eNoAction, eSetBits } eNotifyAction;
+
+#define pdFALSE 0
+#define pdTRUE  1
+#define configTICK_RATE_HZ 1000U
+#define pdMS_TO_TICKS(ms) \
+	((TickType_t) (((uint64_t) (ms) * configTICK_RATE_HZ) / 1000U))
+#define portEND_SWITCHING_ISR(woken) ((void) (woken))
+
+BaseType_t xTaskNotifyFromISR (TaskHandle_t task, uint32_t value,
+	eNotifyAction action, BaseType_t * woken);
+BaseType_t xTaskNotifyWait (uint32_t clear_entry, uint32_t clear_exit,
+	uint32_t * value, TickType_t ticks);
+
+
+/// System services, board pins
+
+typedef unsigned short SYS_MODULE_INDEX;
+typedef uintptr_t SYS_TIME_HANDLE;
+typedef void (*SYS_TIME_CALLBACK) (uintptr_t context);
+typedef enum { SYS_TIME_SINGLE, SYS_TIME_PERIODIC } SYS_TIME_CALLBACK_TYPE;
+
+SYS_TIME_HANDLE SYS_TIME_CallbackRegisterMS (SYS_TIME_CALLBACK callback,
+	uintptr_t context, uint32_t ms, SYS_TIME_CALLBACK_TYPE type);
+uint64_t SYS_TIME_Counter64Get (void);
+
+void LED0_Set (void);
+void LED0_Clear (void);
+void LED1_Set (void);
+void LED1_Clear (void);
+void LED2_Toggle (void);
+void LDACn_Set (void);
+void LDACn_Clear (void);
+
+
+/// Drivers, opened but never answered on the host
+
+typedef uintptr_t DRV_HANDLE;
+#define DRV_HANDLE_INVALID ((DRV_HANDLE) -1)
+#define DRV_IO_INTENT_READWRITE 0x03U
+#define DRV_IO_INTENT_EXCLUSIVE 0x08U
+#define DRV_SPI_INDEX_0 0
+#define DRV_SPI_INDEX_1 1
+#define DRV_I2C_INDEX_0 0
+
+DRV_HANDLE DRV_SPI_Open (SYS_MODULE_INDEX index, unsigned int intent);
+bool DRV_SPI_WriteTransfer (DRV_HANDLE handle, void * tx, size_t tx_size);
+bool DRV_SPI_ReadTransfer (DRV_HANDLE handle, void * rx, size_t rx_size);
+bool DRV_SPI_WriteReadTransfer (DRV_HANDLE handle, void * tx, size_t tx_size,
+	void * rx, size_t rx_size);
+DRV_HANDLE DRV_I2C_Open (SYS_MODULE_INDEX index, unsigned int intent);
+bool DRV_I2C_WriteTransfer (DRV_HANDLE handle, uint16_t address,
+	void * tx, size_t tx_size);
+
+
+/// USB device layer
+
+#define USB_DEVICE_INDEX_0 0
+
+typedef uintptr_t USB_DEVICE_HANDLE;
+#define USB_DEVICE_HANDLE_INVALID ((USB_DEVICE_HANDLE) -1)
+
+typedef enum
+{
+	USB_DEVICE_EVENT_ERROR,
+	USB_DEVICE_EVENT_RESET,
+	USB_DEVICE_EVENT_RESUMED,
+	USB_DEVICE_EVENT_SUSPENDED,
+	USB_DEVICE_EVENT_SOF,
+	USB_DEVICE_EVENT_POWER_DETECTED,
+	USB_DEVICE_EVENT_POWER_REMOVED,
+	USB_DEVICE_EVENT_CONFIGURED,
+	USB_DEVICE_EVENT_DECONFIGURED
+} USB_DEVICE_EVENT;
+
+typedef struct
+{
+	uint8_t configurationValue;
+} USB_DEVICE_EVENT_DATA_CONFIGURED;
+
+typedef enum
+{
+	USB_DEVICE_CONTROL_STATUS_OK,
+	USB_DEVICE_CONTROL_STATUS_ERROR
+} USB_DEVICE_CONTROL_STATUS;
+
+typedef void USB_DEVICE_EVENT_RESPONSE;
+typedef USB_DEVICE_EVENT_RESPONSE (*USB_DEVICE_EVENT_HANDLER) (
+	USB_DEVICE_EVENT event, void * eventData, uintptr_t context);
+
+USB_DEVICE_HANDLE USB_DEVICE_Open (SYS_MODULE_INDEX index,
+	unsigned int intent);
+void USB_DEVICE_EventHandlerSet (USB_DEVICE_HANDLE handle,
+	const USB_DEVICE_EVENT_HANDLER callback, uintptr_t context);
+void USB_DEVICE_Attach (USB_DEVICE_HANDLE handle);
+void USB_DEVICE_Detach (USB_DEVICE_HANDLE handle);
+int  USB_DEVICE_ControlSend (USB_DEVICE_HANDLE handle, void * data,
+	size_t length);
+int  USB_DEVICE_ControlReceive (USB_DEVICE_HANDLE handle, void * data,
+	size_t length);
+int  USB_DEVICE_ControlStatus (USB_DEVICE_HANDLE handle,
+	USB_DEVICE_CONTROL_STATUS status);
+
+
+/// USB CDC function driver
+
+typedef struct __attribute__((packed))
+{
+	uint32_t dwDTERate;
+	uint8_t  bCharFormat;
+	uint8_t  bParityType;
+	uint8_t  bDataBits;
+} USB_CDC_LINE_CODING;
+
+typedef struct
+{
+	unsigned dtr : 1;
+	unsigned carrier : 1;
+} USB_CDC_CONTROL_LINE_STATE;
+
+typedef uintptr_t USB_DEVICE_CDC_INDEX;
+#define USB_DEVICE_CDC_INDEX_0 0
+
+typedef uintptr_t USB_DEVICE_CDC_TRANSFER_HANDLE;
+#define USB_DEVICE_CDC_TRANSFER_HANDLE_INVALID \
+	((USB_DEVICE_CDC_TRANSFER_HANDLE) -1)
+
+typedef enum
+{
+	USB_DEVICE_CDC_TRANSFER_FLAGS_DATA_COMPLETE = 1,
+	USB_DEVICE_CDC_TRANSFER_FLAGS_MORE_DATA_PENDING = 2
+} USB_DEVICE_CDC_TRANSFER_FLAGS;
+
+typedef enum
+{
+	USB_DEVICE_CDC_RESULT_OK,
+	USB_DEVICE_CDC_RESULT_ERROR
+} USB_DEVICE_CDC_RESULT;
+
+typedef enum
+{
+	USB_DEVICE_CDC_EVENT_SET_LINE_CODING,
+	USB_DEVICE_CDC_EVENT_GET_LINE_CODING,
+	USB_DEVICE_CDC_EVENT_SET_CONTROL_LINE_STATE,
+	USB_DEVICE_CDC_EVENT_SEND_BREAK,
+	USB_DEVICE_CDC_EVENT_WRITE_COMPLETE,
+	USB_DEVICE_CDC_EVENT_READ_COMPLETE,
+	USB_DEVICE_CDC_EVENT_CONTROL_TRANSFER_DATA_RECEIVED,
+	USB_DEVICE_CDC_EVENT_CONTROL_TRANSFER_DATA_SENT
+} USB_DEVICE_CDC_EVENT;
+
+typedef struct
+{
+	USB_DEVICE_CDC_TRANSFER_HANDLE handle;
+	size_t length;
+} USB_DEVICE_CDC_EVENT_DATA_READ_COMPLETE,
+	USB_DEVICE_CDC_EVENT_DATA_WRITE_COMPLETE;
+
+typedef struct
+{
+	uint16_t breakDuration;
+} USB_DEVICE_CDC_EVENT_DATA_SEND_BREAK;
+
+typedef enum
+{
+	USB_DEVICE_CDC_EVENT_RESPONSE_NONE
+} USB_DEVICE_CDC_EVENT_RESPONSE;
+
+typedef USB_DEVICE_CDC_EVENT_RESPONSE (*USB_DEVICE_CDC_EVENT_HANDLER) (
+	USB_DEVICE_CDC_INDEX index, USB_DEVICE_CDC_EVENT event, void * pData,
+	uintptr_t userData);
+
+USB_DEVICE_CDC_RESULT USB_DEVICE_CDC_EventHandlerSet (
+	USB_DEVICE_CDC_INDEX index, USB_DEVICE_CDC_EVENT_HANDLER handler,
+	uintptr_t userData);
+USB_DEVICE_CDC_RESULT USB_DEVICE_CDC_Read (USB_DEVICE_CDC_INDEX index,
+	USB_DEVICE_CDC_TRANSFER_HANDLE * handle, void * data, size_t size);
+USB_DEVICE_CDC_RESULT USB_DEVICE_CDC_Write (USB_DEVICE_CDC_INDEX index,
+	USB_DEVICE_CDC_TRANSFER_HANDLE * handle, const void * data, size_t size,
+	USB_DEVICE_CDC_TRANSFER_FLAGS flags);
+
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* DEFINITIONS_H */
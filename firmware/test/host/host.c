@@ -0,0 +1,484 @@
+/*
+ * Host Build Harness
+ * 
+ * @Company
+ *   Probe-Scope Team
+ * 
+ * @File Name
+ *   host.c
+ * 
+ * @Summary
+ *   Runs the app task against capture_sim with a modelled USB host
+*/
+
+#include "host.h"
+
+#include "app.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+// SYS_TIME callbacks the app registers, the blink and the 1 ms tick
+#define HOST_TIMERS 4U
+
+// Host bytes waiting for the device to read them
+#define HOST_TX_SIZE 0x1000U
+
+// Writes the modelled USB holds at once, more than the CDC queue takes
+#define HOST_WRITES 8U
+
+// High speed bulk packet, writes that are not whole ones end a transfer
+#define HOST_USB_PACKET 512U
+
+typedef struct
+{
+	const uint8_t * data;
+	size_t          size;
+} host_write_t;
+
+typedef struct
+{
+	SYS_TIME_CALLBACK callback;
+	uintptr_t         context;
+	uint64_t          period;
+	uint64_t          due;
+} host_timer_t;
+
+static struct
+{
+	uint32_t     notified;
+	host_timer_t timers[HOST_TIMERS];
+	uint32_t     timer_count;
+	
+	USB_DEVICE_EVENT_HANDLER     device_handler;
+	uintptr_t                    device_context;
+	USB_DEVICE_CDC_EVENT_HANDLER cdc_handler;
+	uintptr_t                    cdc_context;
+	
+	// One read is outstanding at a time. Writes complete in order and are
+	// read from the device when they do, as the bus would.
+	uint8_t *    read_buffer;
+	size_t       read_size;
+	bool         read_pending;
+	host_write_t writes[HOST_WRITES];
+	uint32_t     write_head;
+	uint32_t     write_tail;
+	bool         faults;
+	
+	uint8_t      tx[HOST_TX_SIZE];
+	uint32_t     tx_head;
+	uint32_t     tx_tail;
+	
+	uint8_t      rx[HOST_RX_SIZE];
+	uint32_t     rx_head;
+	uint32_t     rx_tail;
+	
+	int          failures;
+} host;
+
+TaskHandle_t xAPP_Tasks;
+
+
+/// FreeRTOS, the task never blocks, time only moves in host_run()
+
+BaseType_t
+xTaskNotifyFromISR (TaskHandle_t task, uint32_t value, eNotifyAction action,
+	BaseType_t * woken)
+{
+	host.notified |= value;
+	*woken = pdFALSE;
+	return pdTRUE;
+}
+
+BaseType_t
+xTaskNotifyWait (uint32_t clear_entry, uint32_t clear_exit, uint32_t * value,
+	TickType_t ticks)
+{
+	*value = host.notified;
+	host.notified &= ~clear_exit;
+	return 0 != *value ? pdTRUE : pdFALSE;
+}
+
+
+/// System services, board pins
+
+SYS_TIME_HANDLE
+SYS_TIME_CallbackRegisterMS (SYS_TIME_CALLBACK callback, uintptr_t context,
+	uint32_t ms, SYS_TIME_CALLBACK_TYPE type)
+{
+	host_timer_t * timer;
+	
+	if (host.timer_count >= HOST_TIMERS)
+	{
+		return 0;
+	}
+	timer = &(host.timers[host.timer_count++]);
+	timer->callback = callback;
+	timer->context = context;
+	timer->period = (uint64_t) ms * (CAPTURE_SIM_TICK_RATE / 1000U);
+	timer->due = capture_sim_now() + timer->period;
+	return host.timer_count;
+}
+
+uint64_t
+SYS_TIME_Counter64Get (void)
+{
+	return capture_sim_now();
+}
+
+void LED0_Set (void) {}
+void LED0_Clear (void) {}
+void LED1_Set (void) {}
+void LED1_Clear (void) {}
+void LED2_Toggle (void) {}
+void LDACn_Set (void) {}
+void LDACn_Clear (void) {}
+
+
+/// Drivers, there is no FPGA, AFE or DAC, writes go nowhere and reads
+/// come back zero
+
+DRV_HANDLE
+DRV_SPI_Open (SYS_MODULE_INDEX index, unsigned int intent)
+{
+	return 1;
+}
+
+bool
+DRV_SPI_WriteTransfer (DRV_HANDLE handle, void * tx, size_t tx_size)
+{
+	return true;
+}
+
+bool
+DRV_SPI_ReadTransfer (DRV_HANDLE handle, void * rx, size_t rx_size)
+{
+	memset(rx, 0, rx_size);
+	return true;
+}
+
+bool
+DRV_SPI_WriteReadTransfer (DRV_HANDLE handle, void * tx, size_t tx_size,
+	void * rx, size_t rx_size)
+{
+	memset(rx, 0, rx_size);
+	return true;
+}
+
+DRV_HANDLE
+DRV_I2C_Open (SYS_MODULE_INDEX index, unsigned int intent)
+{
+	return 1;
+}
+
+bool
+DRV_I2C_WriteTransfer (DRV_HANDLE handle, uint16_t address, void * tx,
+	size_t tx_size)
+{
+	return true;
+}
+
+
+/// USB, the host side of the CDC pipe
+
+USB_DEVICE_HANDLE
+USB_DEVICE_Open (SYS_MODULE_INDEX index, unsigned int intent)
+{
+	return 1;
+}
+
+void
+USB_DEVICE_EventHandlerSet (USB_DEVICE_HANDLE handle,
+	const USB_DEVICE_EVENT_HANDLER callback, uintptr_t context)
+{
+	host.device_handler = callback;
+	host.device_context = context;
+}
+
+void USB_DEVICE_Attach (USB_DEVICE_HANDLE handle) {}
+void USB_DEVICE_Detach (USB_DEVICE_HANDLE handle) {}
+
+int
+USB_DEVICE_ControlSend (USB_DEVICE_HANDLE handle, void * data, size_t length)
+{
+	return 0;
+}
+
+int
+USB_DEVICE_ControlReceive (USB_DEVICE_HANDLE handle, void * data,
+	size_t length)
+{
+	return 0;
+}
+
+int
+USB_DEVICE_ControlStatus (USB_DEVICE_HANDLE handle,
+	USB_DEVICE_CONTROL_STATUS status)
+{
+	return 0;
+}
+
+USB_DEVICE_CDC_RESULT
+USB_DEVICE_CDC_EventHandlerSet (USB_DEVICE_CDC_INDEX index,
+	USB_DEVICE_CDC_EVENT_HANDLER handler, uintptr_t userData)
+{
+	host.cdc_handler = handler;
+	host.cdc_context = userData;
+	return USB_DEVICE_CDC_RESULT_OK;
+}
+
+USB_DEVICE_CDC_RESULT
+USB_DEVICE_CDC_Read (USB_DEVICE_CDC_INDEX index,
+	USB_DEVICE_CDC_TRANSFER_HANDLE * handle, void * data, size_t size)
+{
+	if (host.read_pending)
+	{
+		return USB_DEVICE_CDC_RESULT_ERROR;
+	}
+	host.read_buffer = data;
+	host.read_size = size;
+	host.read_pending = true;
+	*handle = 1;
+	return USB_DEVICE_CDC_RESULT_OK;
+}
+
+USB_DEVICE_CDC_RESULT
+USB_DEVICE_CDC_Write (USB_DEVICE_CDC_INDEX index,
+	USB_DEVICE_CDC_TRANSFER_HANDLE * handle, const void * data, size_t size,
+	USB_DEVICE_CDC_TRANSFER_FLAGS flags)
+{
+	host_write_t * write;
+	
+	HOST_CHECK(USB_DEVICE_CDC_TRANSFER_FLAGS_DATA_COMPLETE == flags
+		|| 0 == size % HOST_USB_PACKET);
+	
+	if (host.write_head - host.write_tail >= HOST_WRITES
+		|| (host.faults && 0 == rand() % 4))
+	{
+		return USB_DEVICE_CDC_RESULT_ERROR;
+	}
+	
+	// Read out when it completes, with a later step
+	write = &(host.writes[host.write_head++ % HOST_WRITES]);
+	write->data = data;
+	write->size = size;
+	*handle = 2;
+	return USB_DEVICE_CDC_RESULT_OK;
+}
+
+void
+host_usb_step (void)
+{
+	USB_DEVICE_CDC_EVENT_DATA_READ_COMPLETE done;
+	
+	while (host.write_tail != host.write_head
+		&& !(host.faults && 0 == rand() % 2))
+	{
+		host_write_t * write = &(host.writes[host.write_tail++ % HOST_WRITES]);
+		size_t i;
+		
+		for (i = 0; i < write->size; i++)
+		{
+			host.rx[host.rx_head++ % HOST_RX_SIZE] = write->data[i];
+		}
+		done.handle = 2;
+		done.length = write->size;
+		host.cdc_handler(USB_DEVICE_CDC_INDEX_0,
+			USB_DEVICE_CDC_EVENT_WRITE_COMPLETE, &done, host.cdc_context);
+	}
+	
+	if (host.read_pending && host.tx_tail != host.tx_head)
+	{
+		done.handle = 1;
+		done.length = 0;
+		while (done.length < host.read_size && host.tx_tail != host.tx_head)
+		{
+			host.read_buffer[done.length++] =
+				host.tx[host.tx_tail++ % HOST_TX_SIZE];
+		}
+		host.read_pending = false;
+		host.cdc_handler(USB_DEVICE_CDC_INDEX_0,
+			USB_DEVICE_CDC_EVENT_READ_COMPLETE, &done, host.cdc_context);
+	}
+}
+
+
+/// Harness
+
+void
+host_start (const capture_sim_config_t * config)
+{
+	USB_DEVICE_EVENT_DATA_CONFIGURED configured = { 1 };
+	
+	memset(&host, 0, sizeof(host));
+	capture_sim_configure(config);
+	APP_Initialize();
+	
+	// comms_task() opens the device layer on its first pass
+	host_run(HOST_STEP_TICKS);
+	HOST_CHECK(NULL != host.device_handler);
+	host.device_handler(USB_DEVICE_EVENT_POWER_DETECTED, NULL,
+		host.device_context);
+	host.device_handler(USB_DEVICE_EVENT_CONFIGURED, &configured,
+		host.device_context);
+	host_run(10U * HOST_STEP_TICKS);
+	HOST_CHECK(APP_STATE_WAIT_FOR_CONFIGURATION != appData.state);
+}
+
+void
+host_run (uint32_t ticks)
+{
+	uint32_t step;
+	uint32_t i;
+	
+	while (ticks)
+	{
+		step = ticks < HOST_STEP_TICKS ? ticks : HOST_STEP_TICKS;
+		ticks -= step;
+		
+		APP_Tasks();
+		if (NULL != host.cdc_handler)
+		{
+			host_usb_step();
+		}
+		capture_sim_advance(step);
+		
+		for (i = 0; i < host.timer_count; i++)
+		{
+			while (host.timers[i].due <= capture_sim_now())
+			{
+				host.timers[i].due += host.timers[i].period;
+				host.timers[i].callback(host.timers[i].context);
+			}
+		}
+	}
+}
+
+void
+host_usb_faults (bool on)
+{
+	host.faults = on;
+}
+
+uint32_t
+host_received (uint8_t * out, uint32_t room)
+{
+	uint32_t o = 0;
+	
+	while (o < room && host.rx_tail != host.rx_head)
+	{
+		out[o++] = host.rx[host.rx_tail++ % HOST_RX_SIZE];
+	}
+	return o;
+}
+
+void
+host_send (const uint8_t * data, uint32_t bytes)
+{
+	uint32_t i;
+	
+	for (i = 0; i < bytes; i++)
+	{
+		host.tx[host.tx_head++ % HOST_TX_SIZE] = data[i];
+	}
+}
+
+static void
+host_send_escaped (const uint8_t * data, uint32_t bytes)
+{
+	static const uint8_t escape = IF_ESCAPE;
+	uint32_t i;
+	
+	for (i = 0; i < bytes; i++)
+	{
+		if (IF_START_MESSAGE == data[i] || IF_END_MESSAGE == data[i]
+			|| IF_END_BLOCK == data[i] || IF_ESCAPE == data[i])
+		{
+			host_send(&escape, 1);
+		}
+		host_send(&(data[i]), 1);
+	}
+}
+
+void
+host_command (uint8_t command, bool tagged, uint8_t tag, const void * data,
+	uint32_t bytes)
+{
+	uint8_t head[2] = { IF_START_MESSAGE,
+		tagged ? IF_MSG_COMMAND_TAGGED : IF_MSG_COMMAND };
+	uint8_t end = IF_END_MESSAGE;
+	
+	host_send(head, sizeof(head));
+	host_send_escaped(&command, 1);
+	if (tagged)
+	{
+		host_send_escaped(&tag, 1);
+	}
+	host_send_escaped(data, bytes);
+	host_send(&end, 1);
+}
+
+uint32_t
+host_message (uint8_t * out, uint32_t room, uint32_t ticks)
+{
+	uint32_t waited = 0;
+	uint32_t i;
+	uint32_t o;
+	
+	for (;;)
+	{
+		// Skip to a start, then look for the end behind it
+		while (host.rx_tail != host.rx_head
+			&& IF_START_MESSAGE != host.rx[host.rx_tail % HOST_RX_SIZE])
+		{
+			host.rx_tail++;
+		}
+		for (i = host.rx_tail, o = 0; i != host.rx_head; i++)
+		{
+			uint8_t b = host.rx[i % HOST_RX_SIZE];
+			
+			if (IF_ESCAPE == b)
+			{
+				if (i + 1U == host.rx_head)
+				{
+					break;
+				}
+				b = host.rx[++i % HOST_RX_SIZE];
+			}
+			else if (IF_END_MESSAGE == b)
+			{
+				host.rx_tail = i + 1U;
+				return o;
+			}
+			if (o < room)
+			{
+				out[o++] = b;
+			}
+		}
+		
+		if (waited >= ticks)
+		{
+			return 0;
+		}
+		host_run(HOST_STEP_TICKS);
+		waited += HOST_STEP_TICKS;
+	}
+}
+
+void
+host_check (bool ok, const char * what, const char * file, int line)
+{
+	if (!ok)
+	{
+		fprintf(stderr, "%s:%d: check failed: %s\n", file, line, what);
+		host.failures++;
+	}
+}
+
+int
+host_failures (void)
+{
+	return host.failures;
+}
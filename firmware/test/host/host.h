@@ -0,0 +1,75 @@
+/*
+ * Host Build Harness
+ * 
+ * @Company
+ *   Probe-Scope Team
+ * 
+ * @File Name
+ *   host.h
+ * 
+ * @Summary
+ *   Runs the app task against capture_sim with a modelled USB host
+*/
+
+#ifndef HOST_H
+#define	HOST_H
+
+
+#include "capture_sim.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+// Model time per pass of the app task
+#define HOST_STEP_TICKS 1000U
+
+// Bytes the modelled host keeps of what the device sent
+#define HOST_RX_SIZE 0x40000U
+
+
+#ifdef	__cplusplus
+extern "C"
+{
+#endif
+
+
+// Configure the model, start the app and run it until USB is configured
+void     host_start (const capture_sim_config_t * config);
+
+// Run the app task, the USB completions and the model for ticks of time
+void     host_run (uint32_t ticks);
+
+// Complete the writes and reads the modelled USB has done, without
+// running the app
+void     host_usb_step (void);
+
+// Refuse writes and hold back their completions at random
+void     host_usb_faults (bool on);
+
+// Take the bytes the device sent, as they came, up to room
+uint32_t host_received (uint8_t * out, uint32_t room);
+
+// Queue bytes the host sends, they go in with the next reads
+void     host_send (const uint8_t * data, uint32_t bytes);
+
+// Send a command as a message, escaped, with an optional tag
+void     host_command (uint8_t command, bool tagged, uint8_t tag,
+                       const void * data, uint32_t bytes);
+
+// Take the next complete message the device sent, unescaped from START to
+// END. Returns its length, 0 if none came within ticks.
+uint32_t host_message (uint8_t * out, uint32_t room, uint32_t ticks);
+
+// Fails the test with the message and the line it came from
+#define HOST_CHECK(cond) host_check((cond), #cond, __FILE__, __LINE__)
+void     host_check (bool ok, const char * what, const char * file,
+                     int line);
+int      host_failures (void);
+
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* HOST_H */
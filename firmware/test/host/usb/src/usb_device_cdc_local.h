@@ -0,0 +1,22 @@
+/*
+ * Host Build USB CDC
+ * 
+ * @Company
+ *   Probe-Scope Team
+ * 
+ * @File Name
+ *   usb_device_cdc_local.h
+ * 
+ * @Summary
+ *   Shadows the Harmony header in host builds
+*/
+
+#ifndef USB_DEVICE_CDC_LOCAL_H
+#define	USB_DEVICE_CDC_LOCAL_H
+
+
+// The CDC types and calls the sources use are in definitions.h
+#include "definitions.h"
+
+
+#endif	/* USB_DEVICE_CDC_LOCAL_H */
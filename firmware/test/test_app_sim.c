@@ -0,0 +1,344 @@
+/*
+ * App Against The Capture Model
+ * 
+ * @Company
+ *   Probe-Scope Team
+ * 
+ * @File Name
+ *   test_app_sim.c
+ * 
+ * @Summary
+ *   Runs APP_Tasks() against capture_sim and checks the frames it sends
+*/
+
+#include "host.h"
+
+#include "app.h"
+
+#include <stdio.h>
+#include <string.h>
+
+
+// A trigger every 2 ms, a record takes 0.8 ms at 10 MHz
+static const uint32_t trigger_pattern[] = { 200000U };
+
+static const capture_sim_config_t sim_config =
+{
+	.sample_rate     = 10000000U,
+	.trigger_pattern = trigger_pattern,
+	.trigger_count   = 1U,
+	.trigger_width   = 1000U,
+	.ready_latency   = 100U,
+	.isr_ticks       = 50U,
+};
+
+static uint8_t message[APP_RECORD_MAX + 64U];
+static uint8_t decoded[APP_RECORD_MAX];
+
+
+static uint32_t
+get_u32 (const uint8_t * p)
+{
+	return (uint32_t) p[0] | (uint32_t) p[1] << 8
+		| (uint32_t) p[2] << 16 | (uint32_t) p[3] << 24;
+}
+
+static void
+put_u32 (uint8_t * p, uint32_t v)
+{
+	p[0] = (uint8_t) v;
+	p[1] = (uint8_t) (v >> 8);
+	p[2] = (uint8_t) (v >> 16);
+	p[3] = (uint8_t) (v >> 24);
+}
+
+static void
+write_reg (uint32_t offset, uint32_t value)
+{
+	// One app_regs_t word through IF_CMD_WRITE_REGS, answered at once
+	uint8_t data[sizeof(if_cmd_data_write_regs_t) + 4U];
+	uint32_t length;
+	
+	data[0] = WRITE_ADDRESS_FI;
+	put_u32(&(data[1]), IF_VM_PIC_START + offset);
+	data[5] = WRITE_LENGTH_FI;
+	put_u32(&(data[6]), 4U);
+	data[10] = WRITE_DATA_FI;
+	put_u32(&(data[11]), value);
+	host_command(IF_CMD_WRITE_REGS, false, 0, data, sizeof(data));
+	
+	length = host_message(message, sizeof(message), 1000000U);
+	HOST_CHECK(length >= 3U && IF_CMD_WRITE_REGS == message[2]);
+}
+
+static uint32_t
+read_regs (uint32_t address, uint32_t length)
+{
+	// IF_CMD_READ_REGS, returns the read length of the answer
+	uint8_t data[sizeof(if_cmd_data_read_regs_t)];
+	uint32_t answer;
+	
+	data[0] = READ_ADDRESS_FI;
+	put_u32(&(data[1]), address);
+	data[5] = READ_LENGTH_FI;
+	put_u32(&(data[6]), length);
+	host_command(IF_CMD_READ_REGS, false, 0, data, sizeof(data));
+	
+	answer = host_message(message, sizeof(message), 1000000U);
+	HOST_CHECK(answer >= 9U && IF_CMD_READ_REGS == message[2]);
+	return (answer >= 9U) ? get_u32(&(message[4])) : 0xFFFFFFFFU;
+}
+
+static void
+check_samples (const uint8_t * msg, uint32_t length, uint32_t head,
+	uint32_t expect)
+{
+	// START, type, command, [tag], 'L', length, 'D', then the record
+	const uint8_t * data = &(msg[head]);
+	uint32_t count;
+	uint32_t i;
+	bool steady = true;
+	
+	HOST_CHECK(length >= head);
+	HOST_CHECK(SAMPLE_DATA_LENGTH_FI == msg[head - 6U]);
+	HOST_CHECK(SAMPLE_DATA_FI == msg[head - 1U]);
+	count = get_u32(&(msg[head - 5U]));
+	HOST_CHECK(expect == count);
+	HOST_CHECK(head + count == length);
+	
+	// The model's samples count up, a record is a run of them
+	for (i = 1; i < count && head + i < length; i++)
+	{
+		steady &= (uint8_t) (data[i - 1U] + 1U) == data[i];
+	}
+	HOST_CHECK(steady);
+}
+
+static void
+test_samples (void)
+{
+	uint32_t length;
+	
+	host_command(IF_CMD_REQ_SAMP_DATA, false, 0, NULL, 0);
+	length = host_message(message, sizeof(message), 20000000U);
+	HOST_CHECK(length > 3U);
+	HOST_CHECK(IF_START_MESSAGE == message[0]);
+	HOST_CHECK(IF_MSG_RESULT == message[1]);
+	HOST_CHECK(IF_CMD_REQ_SAMP_DATA == message[2]);
+	check_samples(message, length, 9U, APP_RECORD_DEFAULT);
+}
+
+static void
+test_samples_tagged (void)
+{
+	uint32_t length;
+	
+	// The tag is a framing byte, it goes escaped both ways
+	host_command(IF_CMD_REQ_SAMP_DATA, true, IF_START_MESSAGE, NULL, 0);
+	length = host_message(message, sizeof(message), 20000000U);
+	HOST_CHECK(length > 4U);
+	HOST_CHECK(IF_MSG_RESULT_TAGGED == message[1]);
+	HOST_CHECK(IF_CMD_REQ_SAMP_DATA == message[2]);
+	HOST_CHECK(IF_START_MESSAGE == message[3]);
+	check_samples(message, length, 10U, APP_RECORD_DEFAULT);
+}
+
+static void
+test_samples_coded (void)
+{
+	// Coded records run to the end of the message, the CRC trailer is the
+	// last 4 bytes and is of the samples before coding
+	uint32_t length;
+	uint32_t count;
+	uint32_t coded;
+	bool steady = true;
+	uint32_t i;
+	
+	write_reg(offsetof(app_regs_t, compression), CODEC_DELTA);
+	write_reg(offsetof(app_regs_t, crc), 1U);
+	
+	host_command(IF_CMD_REQ_SAMP_DATA, false, 0, NULL, 0);
+	length = host_message(message, sizeof(message), 20000000U);
+	HOST_CHECK(length > 13U + 4U);
+	HOST_CHECK(IF_CMD_REQ_SAMP_DATA == message[2]);
+	HOST_CHECK(SAMPLE_DATA_LENGTH_FI == message[3]);
+	HOST_CHECK(SAMPLE_CODEC_FI == message[8]);
+	HOST_CHECK(CODEC_DELTA == get_u32(&(message[9])));
+	HOST_CHECK(SAMPLE_DATA_FI == message[13]);
+	if (length <= 13U + 4U)
+	{
+		return;
+	}
+	
+	count = get_u32(&(message[4]));
+	coded = length - 14U - 4U;
+	HOST_CHECK(APP_RECORD_DEFAULT == count);
+	HOST_CHECK(coded < count);
+	HOST_CHECK(count == codec_decode(&(message[14]), coded, decoded,
+		sizeof(decoded)));
+	for (i = 1; i < count; i++)
+	{
+		steady &= (uint8_t) (decoded[i - 1U] + 1U) == decoded[i];
+	}
+	HOST_CHECK(steady);
+	HOST_CHECK(crc32(0, decoded, count) == get_u32(&(message[14U + coded])));
+	
+	write_reg(offsetof(app_regs_t, compression), CODEC_NONE);
+	write_reg(offsetof(app_regs_t, crc), 0U);
+}
+
+static uint32_t
+samples_of (uint32_t expect)
+{
+	// Frames taken before the model changed may still be queued, ask until
+	// one of expect samples comes
+	uint32_t length = 0;
+	unsigned int i;
+	
+	for (i = 0; i < 4U; i++)
+	{
+		host_command(IF_CMD_REQ_SAMP_DATA, false, 0, NULL, 0);
+		length = host_message(message, sizeof(message), 20000000U);
+		if (length >= 9U && expect == get_u32(&(message[4])))
+		{
+			break;
+		}
+	}
+	return length;
+}
+
+static void
+test_samples_short (void)
+{
+	// The FPGA drops buffer ready early, the record ends where it did
+	capture_sim_config_t config = sim_config;
+	uint32_t length;
+	
+	config.ready_length = 1000U;
+	capture_sim_configure(&config);
+	length = samples_of(1000U);
+	check_samples(message, length, 9U, 1000U);
+	
+	capture_sim_configure(&sim_config);
+	length = samples_of(APP_RECORD_DEFAULT);
+	check_samples(message, length, 9U, APP_RECORD_DEFAULT);
+}
+
+static void
+test_measure_frequency (void)
+{
+	// The model's samples are a sawtooth of 256 samples. The frequency is
+	// taken from the sample rate the host gives, not the readout speed,
+	// which in the model is sample_rate.
+	const uint32_t rate = 2U * sim_config.sample_rate;
+	const uint8_t * result;
+	uint32_t length;
+	uint32_t frequency;
+	
+	write_reg(offsetof(app_regs_t, measure), MEASURE_FREQ);
+	write_reg(offsetof(app_regs_t, sample_rate), rate);
+	
+	// The first frame may have been armed before the writes
+	host_command(IF_CMD_MEASURE, false, 0, NULL, 0);
+	host_message(message, sizeof(message), 20000000U);
+	host_command(IF_CMD_MEASURE, false, 0, NULL, 0);
+	length = host_message(message, sizeof(message), 20000000U);
+	HOST_CHECK(length == 9U + sizeof(measure_result_t));
+	if (length != 9U + sizeof(measure_result_t))
+	{
+		return;
+	}
+	
+	result = &(message[9]);
+	frequency = get_u32(&(result[offsetof(measure_result_t, frequency)]));
+	HOST_CHECK(get_u32(&(result[offsetof(measure_result_t, valid)]))
+		& MEASURE_FREQ);
+	HOST_CHECK(256U << 8
+		== get_u32(&(result[offsetof(measure_result_t, period)])));
+	HOST_CHECK((rate + 128U) / 256U == frequency);
+	
+	write_reg(offsetof(app_regs_t, measure), 0);
+	write_reg(offsetof(app_regs_t, sample_rate), 0);
+}
+
+static void
+test_read_ranges (void)
+{
+	// A length that wraps round to just past the start is no way round
+	// the end of a region, nor is an empty one
+	static const uint32_t starts[] =
+	{
+		IF_VM_PIC_START, IF_VM_STAT_START, IF_VM_HIST_START,
+		IF_VM_MASK_START
+	};
+	unsigned int i;
+	
+	for (i = 0; i < sizeof(starts) / sizeof(starts[0]); i++)
+	{
+		HOST_CHECK(0 == read_regs(starts[i], 0U - starts[i] + 1U));
+		HOST_CHECK(0 == read_regs(starts[i] + 1U, 0xFFFFFFFFU));
+		HOST_CHECK(0 == read_regs(starts[i], 0));
+	}
+	HOST_CHECK(IF_VM_MASK_LENGTH == read_regs(IF_VM_MASK_START,
+		IF_VM_MASK_LENGTH));
+	HOST_CHECK(0 == read_regs(IF_VM_MASK_START, IF_VM_MASK_LENGTH + 1U));
+	HOST_CHECK(4U == read_regs(IF_VM_PIC_END - 3U, 4U));
+}
+
+static void
+test_dac_read (void)
+{
+	// DAC reads are not implemented, a tagged one is still answered
+	uint8_t data[sizeof(if_cmd_data_read_regs_t)];
+	uint32_t length;
+	
+	data[0] = READ_ADDRESS_FI;
+	put_u32(&(data[1]), IF_VM_DAC_START);
+	data[5] = READ_LENGTH_FI;
+	put_u32(&(data[6]), 2U);
+	host_command(IF_CMD_READ_REGS, true, 11U, data, sizeof(data));
+	
+	length = host_message(message, sizeof(message), 1000000U);
+	HOST_CHECK(length >= 10U);
+	HOST_CHECK(IF_MSG_RESULT_TAGGED == message[1]);
+	HOST_CHECK(IF_CMD_READ_REGS == message[2]);
+	HOST_CHECK(11U == message[3]);
+	HOST_CHECK(length >= 10U && 0 == get_u32(&(message[5])));
+}
+
+static void
+test_notice_rejected (void)
+{
+	// Commands only the device sends are not taken from the host, what
+	// comes back is the answer to the command after them
+	uint8_t event[sizeof(if_cmd_data_event_t)] = { 0 };
+	uint32_t length;
+	
+	host_command(IF_CMD_TRIGGERED, true, 7U, NULL, 0);
+	host_command(IF_CMD_EVENT, true, 8U, event, sizeof(event));
+	host_command(IF_CMD_REQ_SAMP_DATA, true, 9U, NULL, 0);
+	length = host_message(message, sizeof(message), 20000000U);
+	HOST_CHECK(length > 4U);
+	HOST_CHECK(IF_MSG_RESULT_TAGGED == message[1]);
+	HOST_CHECK(IF_CMD_REQ_SAMP_DATA == message[2]);
+	HOST_CHECK(9U == message[3]);
+	check_samples(message, length, 10U, APP_RECORD_DEFAULT);
+}
+
+int
+main (void)
+{
+	host_start(&sim_config);
+	test_samples();
+	test_samples_tagged();
+	test_samples_coded();
+	test_notice_rejected();
+	test_samples_short();
+	test_measure_frequency();
+	test_read_ranges();
+	test_dac_read();
+	test_samples();
+	
+	printf("test_app_sim: %s\n", host_failures() ? "FAIL" : "ok");
+	return host_failures() ? 1 : 0;
+}
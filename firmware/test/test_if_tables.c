@@ -0,0 +1,282 @@
+/*
+ * Message Tables
+ * 
+ * @Company
+ *   Probe-Scope Team
+ * 
+ * @File Name
+ *   test_if_tables.c
+ * 
+ * @Summary
+ *   Checks the message lengths interface.c takes from its tables
+*/
+
+// The lookups are static, the test goes in with them
+#include "../src/interface.c"
+
+#include "host.h"
+
+#include <stdio.h>
+#include <string.h>
+
+
+#define FIELD(f)  offsetof(if_msg_data_t, f)
+#define NO_FIELD  0xFFFFFFFFU
+
+typedef struct
+{
+	if_msg_type_t type;
+	bool          outgoing;
+	uint8_t       command;
+	uint32_t      data_length;
+	uint32_t      var_field;    // uint32_t count of the variable bytes
+} expect_t;
+
+// What each message carries, written out from the structs rather than
+// from the tables under test
+static const expect_t expected[] =
+{
+	{ IF_MSG_COMMAND, false, IF_CMD_REQ_SAMP_DATA, 0, NO_FIELD },
+	{ IF_MSG_COMMAND, false, IF_CMD_WRITE_REGS,
+		sizeof(if_cmd_data_write_regs_t),
+		FIELD(cmd_data_write_regs.write_length) },
+	{ IF_MSG_COMMAND, false, IF_CMD_READ_REGS,
+		sizeof(if_cmd_data_read_regs_t), NO_FIELD },
+	{ IF_MSG_COMMAND, false, IF_CMD_MEASURE, 0, NO_FIELD },
+	{ IF_MSG_COMMAND, false, IF_CMD_FRAMING,
+		sizeof(if_cmd_data_framing_t), NO_FIELD },
+	{ IF_MSG_COMMAND, false, IF_CMD_VECTOR, sizeof(if_cmd_data_vector_t),
+		FIELD(cmd_data_vector.vector_length) },
+	
+	{ IF_MSG_COMMAND, true, IF_CMD_TRIGGERED, 0, NO_FIELD },
+	{ IF_MSG_COMMAND, true, IF_CMD_STREAM_DATA,
+		sizeof(if_cmd_data_stream_data_t),
+		FIELD(cmd_data_stream_data.stream_length) },
+	{ IF_MSG_COMMAND, true, IF_CMD_EVENT, sizeof(if_cmd_data_event_t),
+		NO_FIELD },
+	
+	{ IF_MSG_RESULT, true, IF_CMD_WRITE_REGS,
+		sizeof(if_res_data_write_regs_t), NO_FIELD },
+	{ IF_MSG_RESULT, true, IF_CMD_READ_REGS,
+		sizeof(if_res_data_read_regs_t),
+		FIELD(res_data_read_regs.read_length) },
+	{ IF_MSG_RESULT, true, IF_CMD_FRAMING, sizeof(if_res_data_framing_t),
+		NO_FIELD },
+	{ IF_MSG_RESULT, true, IF_CMD_VECTOR, sizeof(if_res_data_vector_t),
+		FIELD(res_data_vector.vector_length) },
+};
+
+// Rows as the tables have them, to check every one is expected
+typedef struct
+{
+	if_msg_type_t type;
+	bool          outgoing;
+	uint8_t       command;
+} row_t;
+
+#define ROW_COMMAND(command, data_length, var_offset, handler) \
+	{ IF_MSG_COMMAND, false, (command) },
+#define ROW_NOTICE(command, data_length, var_offset, handler) \
+	{ IF_MSG_COMMAND, true, (command) },
+#define ROW_RESULT(command, data_length, var_offset, handler) \
+	{ IF_MSG_RESULT, true, (command) },
+
+static const row_t rows[] =
+{
+	IF_COMMANDS(ROW_COMMAND)
+	IF_NOTICES(ROW_NOTICE)
+	IF_RESULTS(ROW_RESULT)
+};
+
+// Results whose lengths come from more than one field, checked below
+static const uint8_t own_results[] =
+{
+	IF_CMD_REQ_SAMP_DATA, IF_CMD_SEGMENTS, IF_CMD_MEASURE
+};
+
+
+static void
+message (if_message_t * msg, if_msg_type_t type, uint8_t command)
+{
+	memset(msg, 0, sizeof(*msg));
+	memset(&(msg->data), 0xA5, sizeof(msg->data));
+	msg->type = type;
+	msg->command = command;
+}
+
+static void
+test_fixed (void)
+{
+	uint32_t i;
+	
+	for (i = 0; i < sizeof(expected) / sizeof(expected[0]); i++)
+	{
+		const expect_t * e = &(expected[i]);
+		const if_msg_desc_t * desc = if_msg_desc(e->type, e->command,
+			e->outgoing);
+		if_message_t msg;
+		uint32_t var = 0x1234U + i;
+		
+		HOST_CHECK(NULL != desc);
+		if (NULL == desc)
+		{
+			fprintf(stderr, "  no %c %c\n", e->type, e->command);
+			continue;
+		}
+		
+		message(&msg, e->type, e->command);
+		HOST_CHECK((int) e->data_length == if_msg_data_len(desc, &msg));
+		
+		// The count must sit inside the data and be the one taken
+		if (NO_FIELD == e->var_field)
+		{
+			HOST_CHECK(0 == if_msg_var_len(desc, &msg));
+		}
+		else
+		{
+			HOST_CHECK(e->var_field + sizeof(var) <= e->data_length);
+			memcpy(&(msg.data.bytes[e->var_field]), &var, sizeof(var));
+			HOST_CHECK((int) var == if_msg_var_len(desc, &msg));
+		}
+	}
+}
+
+static void
+test_rows (void)
+{
+	uint32_t i, k;
+	
+	for (i = 0; i < sizeof(rows) / sizeof(rows[0]); i++)
+	{
+		bool found = false;
+		
+		for (k = 0; k < sizeof(expected) / sizeof(expected[0]); k++)
+		{
+			found |= rows[i].type == expected[k].type
+				&& rows[i].outgoing == expected[k].outgoing
+				&& rows[i].command == expected[k].command;
+		}
+		for (k = 0; k < sizeof(own_results); k++)
+		{
+			found |= IF_MSG_RESULT == rows[i].type
+				&& own_results[k] == rows[i].command;
+		}
+		HOST_CHECK(found);
+	}
+	HOST_CHECK(sizeof(rows) / sizeof(rows[0])
+		== sizeof(expected) / sizeof(expected[0]) + sizeof(own_results));
+}
+
+static void
+test_direction (void)
+{
+	// Notices are not taken from the host, nor anything unlisted
+	uint32_t c;
+	
+	HOST_CHECK(NULL == if_msg_desc(IF_MSG_COMMAND, IF_CMD_TRIGGERED, false));
+	HOST_CHECK(NULL == if_msg_desc(IF_MSG_COMMAND, IF_CMD_STREAM_DATA,
+		false));
+	HOST_CHECK(NULL == if_msg_desc(IF_MSG_COMMAND, IF_CMD_EVENT, false));
+	HOST_CHECK(NULL == if_msg_desc(IF_MSG_COMMAND, IF_CMD_WRITE_REGS, true));
+	HOST_CHECK(NULL == if_msg_desc(IF_MSG_COMMAND_TAGGED,
+		IF_CMD_WRITE_REGS, false));
+	
+	for (c = 0; c < 256U; c++)
+	{
+		if (c < 'a' || c > 'z')
+		{
+			HOST_CHECK(NULL == if_msg_desc(IF_MSG_COMMAND, (uint8_t) c,
+				false));
+			HOST_CHECK(NULL == if_msg_desc(IF_MSG_RESULT, (uint8_t) c,
+				true));
+		}
+	}
+}
+
+static void
+test_sample_data (void)
+{
+	// The field after the sample length tells the layout
+	static const struct
+	{
+		char     fi;
+		uint32_t data_length;
+		bool     logic;
+	} kinds[] =
+	{
+		{ SAMPLE_DATA_FI, sizeof(if_res_data_req_samp_data_t), false },
+		{ LOGIC_DATA_LENGTH_FI, sizeof(if_res_data_mixed_t), true },
+		{ PEAK_RECORD_LENGTH_FI, sizeof(if_res_data_peak_t), false },
+		{ AVERAGE_COUNT_FI, sizeof(if_res_data_average_t), false },
+		{ AVERAGE16_COUNT_FI, sizeof(if_res_data_average_t), false },
+		{ SAMPLE_CODEC_FI, sizeof(if_res_data_coded_t), false },
+		{ SPECTRUM_LENGTH_FI, sizeof(if_res_data_spectrum_t), false },
+		{ SPECTRUM_LOG_FI, sizeof(if_res_data_spectrum_t), false },
+	};
+	const if_msg_desc_t * desc = if_msg_desc(IF_MSG_RESULT,
+		IF_CMD_REQ_SAMP_DATA, true);
+	if_message_t msg;
+	uint32_t i;
+	
+	HOST_CHECK(NULL != desc);
+	if (NULL == desc)
+	{
+		return;
+	}
+	for (i = 0; i < sizeof(kinds) / sizeof(kinds[0]); i++)
+	{
+		message(&msg, IF_MSG_RESULT, IF_CMD_REQ_SAMP_DATA);
+		msg.data.res_data_mixed.sample_data_length_fi = SAMPLE_DATA_LENGTH_FI;
+		msg.data.res_data_mixed.sample_data_length = 1000U;
+		msg.data.res_data_mixed.logic_data_length_fi = kinds[i].fi;
+		msg.data.res_data_mixed.logic_data_length = 96U;
+		
+		HOST_CHECK((int) kinds[i].data_length
+			== if_msg_data_len(desc, &msg));
+		HOST_CHECK((kinds[i].logic ? 1096 : 1000)
+			== if_msg_var_len(desc, &msg));
+	}
+}
+
+static void
+test_own_results (void)
+{
+	const if_msg_desc_t * desc;
+	if_message_t msg;
+	
+	desc = if_msg_desc(IF_MSG_RESULT, IF_CMD_SEGMENTS, true);
+	HOST_CHECK(NULL != desc);
+	if (NULL != desc)
+	{
+		message(&msg, IF_MSG_RESULT, IF_CMD_SEGMENTS);
+		msg.data.res_data_segments.segment_count = 5U;
+		msg.data.res_data_segments.segment_length = 300U;
+		HOST_CHECK((int) sizeof(if_res_data_segments_t)
+			== if_msg_data_len(desc, &msg));
+		HOST_CHECK(5 * (8 + 300) == if_msg_var_len(desc, &msg));
+	}
+	
+	desc = if_msg_desc(IF_MSG_RESULT, IF_CMD_MEASURE, true);
+	HOST_CHECK(NULL != desc);
+	if (NULL != desc)
+	{
+		message(&msg, IF_MSG_RESULT, IF_CMD_MEASURE);
+		HOST_CHECK((int) sizeof(if_res_data_measure_t)
+			== if_msg_data_len(desc, &msg));
+		HOST_CHECK((int) sizeof(measure_result_t)
+			== if_msg_var_len(desc, &msg));
+	}
+}
+
+int
+main (void)
+{
+	test_fixed();
+	test_rows();
+	test_direction();
+	test_sample_data();
+	test_own_results();
+	
+	printf("test_if_tables: %s\n", host_failures() ? "FAIL" : "ok");
+	return host_failures() ? 1 : 0;
+}
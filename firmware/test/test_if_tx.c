@@ -0,0 +1,387 @@
+/*
+ * Transmit Path
+ * 
+ * @Company
+ *   Probe-Scope Team
+ * 
+ * @File Name
+ *   test_if_tx.c
+ * 
+ * @Summary
+ *   Checks what if_tx_task() sends against a one-shot encoding
+*/
+
+#include "app.h"
+#include "crc.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// The CRC comes late and the frame is watched as it is given back
+bool test_crc_result (uint32_t * crc);
+void test_frame_release (rudimentary_buffer_t * frame);
+
+#define crc_result       test_crc_result
+#define APP_FrameRelease test_frame_release
+
+// The transmit task is static, the test goes in with it
+#include "../src/interface.c"
+
+#undef crc_result
+#undef APP_FrameRelease
+
+#include "host.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#define MESSAGES   400U
+#define VAR_MAX    40000U
+
+// The record in two pieces, as a frame wrapped in the ring
+static uint8_t record_first[VAR_MAX];
+static uint8_t record_wrap[VAR_MAX];
+static uint8_t record[VAR_MAX];
+
+static uint8_t expected[2U * VAR_MAX + 64U];
+static uint8_t received[2U * VAR_MAX + 64U];
+static uint8_t coded[2U * VAR_MAX + 64U];
+static uint8_t record_check[VAR_MAX];
+
+static rudimentary_buffer_t frame;
+static uint32_t released;
+
+
+bool
+test_crc_result (uint32_t * crc)
+{
+	// as if the engine were still reading, now and then
+	if (0 == rand() % 3)
+	{
+		return false;
+	}
+	return crc_result(crc);
+}
+
+void
+test_frame_release (rudimentary_buffer_t * frame_released)
+{
+	HOST_CHECK(&frame == frame_released);
+	HOST_CHECK(!if_data.tx_direct || 0 == comms_transmit_pending(gp_comms));
+	released++;
+	
+	// Acquisition may write over it from here, bytes read later show it
+	memset(record_first, 0xA5, sizeof(record_first));
+	memset(record_wrap, 0xA5, sizeof(record_wrap));
+}
+
+static uint32_t
+put_escaped (uint8_t * out, const uint8_t * in, uint32_t length)
+{
+	uint32_t o = 0;
+	uint32_t i;
+	
+	for (i = 0; i < length; i++)
+	{
+		if (IF_START_MESSAGE == in[i] || IF_END_MESSAGE == in[i]
+			|| IF_END_BLOCK == in[i] || IF_ESCAPE == in[i])
+		{
+			out[o++] = IF_ESCAPE;
+		}
+		out[o++] = in[i];
+	}
+	return o;
+}
+
+static void
+put_u32 (uint8_t * out, uint32_t value)
+{
+	out[0] = (uint8_t) value;
+	out[1] = (uint8_t) (value >> 8);
+	out[2] = (uint8_t) (value >> 16);
+	out[3] = (uint8_t) (value >> 24);
+}
+
+static void
+make_record (uint32_t length)
+{
+	// Framing bytes thick on the ground, or a ramp the codec likes
+	uint32_t i;
+	bool smooth = rand() % 2;
+	uint8_t level = (uint8_t) rand();
+	
+	for (i = 0; i < length; i++)
+	{
+		if (smooth)
+		{
+			level += (uint8_t) (rand() % 5) - 2U;
+			record[i] = level;
+		}
+		else
+		{
+			record[i] = (rand() % 2) ? (uint8_t) (rand() % 0x20)
+				: (uint8_t) rand();
+		}
+	}
+}
+
+static uint32_t
+make_length (void)
+{
+	switch (rand() % 4)
+	{
+		case 0:
+			return 0;
+		
+		case 1:
+			return (uint32_t) (rand() % 64);
+		
+		case 2:
+			return IF_TX_PACKET - 16U + (uint32_t) (rand() % 32);
+		
+		default:
+			return (uint32_t) (rand() % VAR_MAX);
+	}
+}
+
+static uint32_t
+unescape (uint8_t * out, const uint8_t * in, uint32_t length)
+{
+	uint32_t o = 0;
+	uint32_t i;
+	
+	for (i = 0; i < length; i++)
+	{
+		if (IF_ESCAPE == in[i] && i + 1U < length)
+		{
+			i++;
+		}
+		out[o++] = in[i];
+	}
+	return o;
+}
+
+static bool
+check_coded (uint32_t header_length, const uint8_t * var, uint32_t length,
+	bool crc, uint32_t received_length)
+{
+	// Coded in pieces the bytes need not match a one-shot coding, a
+	// literal run stops where a piece does. The samples they decode to do,
+	// and the trailer is the CRC of those.
+	uint32_t n = unescape(coded, received, received_length);
+	uint32_t trailer = crc ? 4U : 0U;
+	uint8_t check[4];
+	
+	if (n < header_length + trailer + 1U
+		|| memcmp(coded, expected, header_length)
+		|| IF_END_MESSAGE != coded[n - 1U])
+	{
+		return false;
+	}
+	n -= header_length + trailer + 1U;
+	if (length != codec_decode(&(coded[header_length]), n, record_check,
+		sizeof(record_check)) || memcmp(record_check, var, length))
+	{
+		return false;
+	}
+	put_u32(check, crc32(0, var, length));
+	return !crc || 0 == memcmp(&(coded[header_length + n]), check, 4U);
+}
+
+static uint32_t
+encode_reference (const if_message_t * msg, const uint8_t * var,
+	uint32_t length, unsigned int framing)
+{
+	// The whole message at once, header, record, trailer. A coded record
+	// gives the header alone and unescaped, see check_coded().
+	uint8_t * data = (uint8_t *) &(msg->data);
+	uint32_t data_length = (CODEC_NONE != msg->var_codec)
+		? sizeof(if_res_data_coded_t) : sizeof(if_res_data_req_samp_data_t);
+	uint32_t crc = crc32(0, var, length);
+	uint8_t trailer[4];
+	uint32_t o = 0;
+	
+	put_u32(trailer, crc);
+	expected[o++] = IF_START_MESSAGE;
+	expected[o++] = msg->tagged ? IF_MSG_RESULT_TAGGED : IF_MSG_RESULT;
+	expected[o++] = msg->command;
+	
+	if (IF_FRAMING_ESCAPED == framing)
+	{
+		if (CODEC_NONE != msg->var_codec)
+		{
+			if (msg->tagged)
+			{
+				expected[o++] = msg->tag;
+			}
+			memcpy(&(expected[o]), data, data_length);
+			return o + data_length;
+		}
+		
+		if (msg->tagged)
+		{
+			o += put_escaped(&(expected[o]), &(msg->tag), 1);
+		}
+		o += put_escaped(&(expected[o]), data, data_length);
+		o += put_escaped(&(expected[o]), var, length);
+		
+		if (msg->var_crc)
+		{
+			o += put_escaped(&(expected[o]), trailer, sizeof(trailer));
+		}
+		expected[o++] = IF_END_MESSAGE;
+	}
+	else
+	{
+		if (msg->tagged)
+		{
+			expected[o++] = msg->tag;
+		}
+		put_u32(&(expected[o]), data_length + length
+			+ (msg->var_crc ? 4U : 0U));
+		o += 4U;
+		memcpy(&(expected[o]), data, data_length);
+		o += data_length;
+		memcpy(&(expected[o]), var, length);
+		o += length;
+		
+		if (msg->var_crc)
+		{
+			memcpy(&(expected[o]), trailer, sizeof(trailer));
+			o += sizeof(trailer);
+		}
+	}
+	return o;
+}
+
+static void
+send_message (unsigned int number)
+{
+	if_message_t * msg = &(if_data.tx_msg);
+	unsigned int framing = (uint32_t) rand() % 2U;
+	uint32_t length = make_length();
+	uint32_t wrap_at = 0;
+	uint32_t expected_length;
+	uint32_t received_length;
+	uint32_t passes = 0;
+	bool ok;
+	bool direct = rand() % 4;
+	bool crc = rand() % 2;
+	uint8_t codec = (IF_FRAMING_ESCAPED == framing && rand() % 2)
+		? CODEC_DELTA : CODEC_NONE;
+	
+	make_record(length);
+	if (length > 1U && rand() % 2)
+	{
+		wrap_at = 1U + (uint32_t) rand() % (length - 1U);
+	}
+	memcpy(record_first, record, wrap_at ? wrap_at : length);
+	memcpy(record_wrap, &(record[wrap_at]), length - wrap_at);
+	
+	msg->type = IF_MSG_RESULT;
+	msg->command = IF_CMD_REQ_SAMP_DATA;
+	msg->tagged = rand() % 2;
+	msg->tag = (uint8_t) rand();
+	msg->var_data = record_first;
+	msg->var_wrap = record_wrap;
+	msg->var_wrap_at = wrap_at;
+	msg->var_direct = direct;
+	msg->var_crc = crc;
+	msg->var_codec = codec;
+	
+	if (CODEC_NONE != msg->var_codec)
+	{
+		msg->data.res_data_coded.sample_data_length_fi =
+			SAMPLE_DATA_LENGTH_FI;
+		msg->data.res_data_coded.sample_data_length = length;
+		msg->data.res_data_coded.sample_codec_fi = SAMPLE_CODEC_FI;
+		msg->data.res_data_coded.sample_codec = msg->var_codec;
+		msg->data.res_data_coded.sample_data_fi = SAMPLE_DATA_FI;
+	}
+	else
+	{
+		msg->data.res_data_req_samp_data.sample_data_length_fi =
+			SAMPLE_DATA_LENGTH_FI;
+		msg->data.res_data_req_samp_data.sample_data_length = length;
+		msg->data.res_data_req_samp_data.sample_data_fi = SAMPLE_DATA_FI;
+	}
+	
+	expected_length = encode_reference(msg, record, length, framing);
+	
+	if_data.framing = framing;
+	if_data.framing_next = framing;
+	if_data.tx_frame = &frame;
+	if_data.tx_state = IF_TX_STATE_ENCODE;
+	released = 0;
+	
+	while (IF_TX_STATE_WAIT != if_data.tx_state && passes++ < 100000U)
+	{
+		if_tx_task();
+		comms_task(gp_comms);
+		host_usb_step();
+	}
+	
+	// The last writes may still be on the bus
+	while (comms_transmit_pending(gp_comms) && passes++ < 100000U)
+	{
+		comms_task(gp_comms);
+		host_usb_step();
+	}
+	
+	received_length = host_received(received, sizeof(received));
+	HOST_CHECK(IF_TX_STATE_WAIT == if_data.tx_state);
+	HOST_CHECK(1U == released);
+	HOST_CHECK(NULL == if_data.tx_frame);
+	
+	if (CODEC_NONE != codec)
+	{
+		ok = check_coded(expected_length, record, length, crc,
+			received_length);
+	}
+	else
+	{
+		ok = expected_length == received_length
+			&& 0 == memcmp(expected, received, expected_length);
+	}
+	HOST_CHECK(ok);
+	
+	if (!ok)
+	{
+		printf("message %u: framing %u, %u bytes, wrap at %u, direct %d, "
+			"crc %d, codec %u\n", number, framing, (unsigned) length,
+			(unsigned) wrap_at, direct, crc, codec);
+	}
+}
+
+// No triggers, nothing but the test sends
+static const capture_sim_config_t sim_config =
+{
+	.sample_rate     = 10000000U,
+	.trigger_pattern = NULL,
+	.trigger_count   = 0,
+	.trigger_width   = 1000U,
+	.ready_latency   = 100U,
+	.isr_ticks       = 50U,
+};
+
+int
+main (void)
+{
+	unsigned int i;
+	
+	srand(1);
+	host_start(&sim_config);
+	host_received(received, sizeof(received));
+	HOST_CHECK(IF_TX_STATE_WAIT == if_data.tx_state);
+	
+	host_usb_faults(true);
+	for (i = 0; i < MESSAGES && 0 == host_failures(); i++)
+	{
+		send_message(i);
+	}
+	
+	printf("test_if_tx: %s\n", host_failures() ? "FAIL" : "ok");
+	return host_failures() ? 1 : 0;
+}